@@ -19,14 +19,31 @@
 #include <cassert>
 #include <cstdint>
 
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
 #include <zvec_codecs.h>
 #include <zvec_dispatch.h>
 #include <zvec_block.h>
+#include <zvec_float.h>
+#include <zvec_small.h>
 #include <zvec_bits.h>
 #include <zvec_logger.h>
 
 #define _sizebits(T) (sizeof(T)<<3)
 
+#if defined (__GNUC__)
+#define _noinline __attribute__((noinline))
+#elif defined (_MSC_VER)
+#define _noinline __declspec(noinline)
+#else
+#define _noinline
+#endif
+
 template<typename T>
 static inline T* _align_ptr(T* ptr, size_t n)
 {
@@ -43,6 +60,37 @@ static inline size_t _pow2_ge(size_t x)
     return 1ull << (_sizebits(size_t) - clz(x-1));
 }
 
+/* adjacent values used to map strict comparisons to closed intervals */
+template <typename V>
+static inline V zvec_prev(V x)
+{
+    if constexpr (std::is_floating_point<V>::value) {
+        return std::nextafter(x, -std::numeric_limits<V>::infinity());
+    } else {
+        return x - 1;
+    }
+}
+
+template <typename V>
+static inline V zvec_next(V x)
+{
+    if constexpr (std::is_floating_point<V>::value) {
+        return std::nextafter(x, std::numeric_limits<V>::infinity());
+    } else {
+        return x + 1;
+    }
+}
+
+enum zvec_cmp
+{
+    zvec_cmp_eq,
+    zvec_cmp_ne,
+    zvec_cmp_lt,
+    zvec_cmp_le,
+    zvec_cmp_gt,
+    zvec_cmp_ge,
+};
+
 template <typename V = i64, typename I = i64, size_t Q = (4096/sizeof(V))>
 struct zip_vector
 {
@@ -51,12 +99,22 @@ struct zip_vector
     static constexpr I page_shift = ilog2(page_interval);
 
     static constexpr size_t invalid_offset = (size_t)(-1ll);
+    static constexpr size_t invalid_page = (size_t)(-1ll);
+    static constexpr size_t invalid_slot = (size_t)(-1ll);
+    static constexpr size_t invalid_epoch = (size_t)(-1ll);
+    static constexpr size_t default_slots = 4;
+    static constexpr size_t retired_pins = 64;
 
     typedef I index_type;
     typedef V value_type;
 
     struct ref;
-    struct iterator;
+    struct page_ref;
+    template <bool C> struct basic_iterator;
+    template <bool C> struct basic_span;
+    struct cursor;
+    struct page_pin;
+    struct accessor;
 
     struct ref
     {
@@ -73,20 +131,165 @@ struct zip_vector
         bool operator!=(const ref &o) const;
     };
 
-    struct iterator
+    /*
+     * reference to an element in a decoded page. assignment marks the
+     * page slot dirty. the element address is resolved again if the epoch
+     * has changed, as the slot may have been evicted by another access.
+     */
+    struct page_ref
+    {
+        zip_vector *vec;
+        size_t y, x, s, epoch;
+        V *p;
+
+        operator V() const;
+        page_ref& operator=(V val);
+    };
+
+    /*
+     * random access iterator that caches a pointer to the decoded page.
+     * increments that cross a page boundary invalidate the cached epoch,
+     * so dereference is a single epoch compare that also catches slots
+     * evicted or a slab moved by other accesses between increments.
+     */
+    template <bool C>
+    struct basic_iterator
+    {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef V value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<C,const V*,V*>::type pointer;
+        typedef typename std::conditional<C,const V&,page_ref>::type reference;
+
+        zip_vector *vec;
+        I idx;
+        size_t y, s, epoch;
+        V *p;
+
+        basic_iterator(zip_vector *vec, I idx);
+
+        V* addr();
+        reference operator*();
+        reference operator[](difference_type n);
+
+        basic_iterator& operator++();
+        basic_iterator operator++(int);
+        basic_iterator& operator--();
+        basic_iterator operator--(int);
+        basic_iterator& operator+=(difference_type n);
+        basic_iterator& operator-=(difference_type n);
+        basic_iterator operator+(difference_type n) const;
+        basic_iterator operator-(difference_type n) const;
+        difference_type operator-(const basic_iterator &o) const;
+
+        bool operator==(const basic_iterator &o) const;
+        bool operator!=(const basic_iterator &o) const;
+        bool operator<(const basic_iterator &o) const;
+        bool operator>(const basic_iterator &o) const;
+        bool operator<=(const basic_iterator &o) const;
+        bool operator>=(const basic_iterator &o) const;
+    };
+
+    typedef basic_iterator<false> iterator;
+    typedef basic_iterator<true> const_iterator;
+
+    /*
+     * span of elements in a decoded page. mutable spans mark the page dirty
+     * when created and const spans never cause a page to be recompressed.
+     * spans are only valid until another page is accessed.
+     */
+    template <bool C>
+    struct basic_span
+    {
+        typedef typename std::conditional<C,const V,V>::type element_type;
+
+        element_type *data;
+        size_t size;
+
+        element_type* begin() const;
+        element_type* end() const;
+        element_type& operator[](size_t i) const;
+    };
+
+    typedef basic_span<false> span;
+    typedef basic_span<true> const_span;
+
+    /*
+     * read cursor with a private decode buffer. cursors decode pages from
+     * the slab independently of the page cache so several cursors can be
+     * positioned on different pages without evicting each other. pages
+     * are copied from the page cache when resident so cursors observe
+     * writes made before moving onto a page.
+     */
+    struct cursor
+    {
+        zip_vector &vec;
+        I idx;
+        size_t y;
+        char *ptr;
+        V *data;
+
+        cursor(zip_vector &vec, I idx = 0);
+        cursor(const cursor&) = delete;
+        ~cursor();
+
+        const V* page();
+        V operator*();
+        cursor& operator++();
+        cursor& operator--();
+        cursor& operator+=(std::ptrdiff_t n);
+        cursor& operator-=(std::ptrdiff_t n);
+        void seek(I idx);
+    };
+
+    /*
+     * concurrent access pins a page by reference count. pinned pages are
+     * decompressed into a private buffer outside of the slab so pointers
+     * survive slab resizes. the slab lock is held shared while looking up
+     * or decoding a pin and exclusive while modifying the slab, bitmap or
+     * page index. the last thread to unpin a dirty page writes it back to
+     * the slab. unpinned pins are retired and their buffers are reused
+     * after the slab lock has been held exclusive, as until then another
+     * thread can still be looking at a retired pin.
+     */
+    enum pin_state { pin_loading, pin_ready };
+
+    struct page_pin
+    {
+        std::atomic<size_t> refs;   /* reference count, zero once unpinned */
+        std::atomic<int> state;     /* loading or ready */
+        std::atomic<bool> dirty;    /* page buffer has been modified */
+        std::atomic<page_pin*> next; /* retired or free list link */
+        char *ptr;                  /* page buffer (base) */
+        V *data;                    /* page buffer (aligned) */
+    };
+
+    struct accessor
     {
-        ref r;
-
-        iterator operator++();
-        iterator operator++(int);
-        ref operator*();
-        ref* operator->();
-        bool operator==(const iterator &o) const;
-        bool operator!=(const iterator &o) const;
+        zip_vector &vec;
+        size_t y;
+        page_pin *pin;
+
+        accessor(zip_vector &vec);
+        accessor(const accessor&) = delete;
+        ~accessor();
+
+        V get(I idx);
+        void set(I idx, V val);
+        void release();
     };
 
     struct page_idx { zvec_meta<V> meta; size_t offset; zvec_format format; };
 
+    /*
+     * decoded page cache slot. slots hold either a scratch area in the
+     * slab owned by the slot or an in-place page for incompressible pages.
+     */
+    struct page_slot { size_t page; size_t area; bool dirty; bool used; bool inplace; };
+
+    /* zone map entry with the minimum and maximum value of a page */
+    struct page_zone { V min; V max; };
+
     page_idx       *_page_idx;     /* compressed page IV, delta, offset, fmt */
     size_t          _page_count;   /* number of metadata pages allocated */
     char           *_slab_ptr;     /* slab of compressed data (base) */
@@ -94,10 +297,26 @@ struct zip_vector
     size_t          _slab_limit;   /* size of slab array */
     u64            *_bmap_data;    /* bitmap of allocated space */
     size_t          _bmap_last;    /* last bitmap allocation offset */
+    page_slot      *_slots;        /* decoded page cache slots */
+    size_t          _slot_count;   /* number of decoded page cache slots */
+    size_t          _slot_hand;    /* clock hand for slot replacement */
+    size_t          _active_slot;  /* slot number of active area */
+    size_t          _epoch;        /* incremented when slots or slab move */
     size_t          _active_page;  /* page number of active area */
     size_t          _active_area;  /* offset to active area within slab */
     I               _count;        /* number of elements in the vector */
     bool            _dirty;        /* active area is dirty */
+    std::atomic<page_pin*> *_page_pin; /* pinned pages for concurrent access */
+    std::atomic<page_pin*> _pin_retired; /* pins unpinned since last reclaim */
+    std::atomic<page_pin*> _pin_free; /* reclaimed pins with page buffers */
+    std::atomic<size_t> _pin_retired_count; /* length of retired list */
+    std::shared_mutex _slab_lock;  /* protects slab, bitmap and page index */
+    page_zone      *_page_zone;    /* optional page zone maps, null if off */
+    V              *_page_sum;     /* optional page sums, null if off */
+    V              *_page_psum;    /* prefix sums of pages, built lazily */
+    size_t          _psum_valid;   /* prefix sums valid up to this page */
+    size_t          _page_decodes; /* pages decoded to scratch by page_data */
+    bool            _ref_pages;    /* search earlier pages for references */
 
     constexpr I f_page_round(I count) { return (count + Q - 1) & ~(Q - 1); }
     constexpr size_t f_page_num(I count) { return (size_t)(count >> page_shift); }
@@ -106,6 +325,8 @@ struct zip_vector
     static constexpr zvec_size zvec_max_size =
         sizeof(V) == 8 ? zvec_size_64 :
         sizeof(V) == 4 ? zvec_size_32 :
+        sizeof(V) == 2 ? zvec_size_16 :
+        sizeof(V) == 1 ? zvec_size_8 :
                          zvec_size_0;
 
     zip_vector(I count);
@@ -114,6 +335,41 @@ struct zip_vector
 
     iterator begin();
     iterator end();
+    const_iterator cbegin();
+    const_iterator cend();
+
+    void copy_out(I begin, I n, V *dst);
+    void assign(I begin, const V *src, I n);
+
+    void push_back(V val);
+    template <typename... Args> void emplace_back(Args&&... args);
+    void append(const V *src, I n);
+    void seal_page();
+
+    size_t page_count();
+    span page_span(size_t y);
+    const_span page_cspan(size_t y);
+    template <typename F> void for_each_page(F f);
+    template <typename F> void for_each_cpage(F f);
+
+    zvec_aggr<V> aggregate();
+    V sum();
+    V min();
+    V max();
+    size_t count_if(zvec_cmp cmp, V val);
+    size_t count_range(V lo, V hi);
+
+    void set_zone_maps(bool enable);
+    I find_if(V lo, V hi, I begin = 0);
+    template <typename F> void filter(V lo, V hi, F f);
+
+    void set_prefix_index(bool enable);
+    V range_sum(I begin, I n);
+
+    void set_ref_pages(bool enable);
+
+    I lower_bound(V val);
+    I upper_bound(V val);
 
     void resize(I count);
     I size();
@@ -130,12 +386,47 @@ struct zip_vector
     size_t alloc_bitmap(zvec_size size);
     void dealloc_bitmap(zvec_size size, size_t offset);
 
+    void set_slots(size_t count);
+    size_t find_slot(size_t y);
+    size_t evict_slot();
+    void fill_slot(page_slot &s, size_t y);
+    void flush_slot(page_slot &s);
+    void release_slot(page_slot &s);
+    void discard_slot(size_t s);
+
     void switch_page(size_t y);
+    void load_page(size_t y, V *dst);
+    void copy_page(size_t y, V *dst);
+    void store_page(size_t y, V *src, size_t skip = invalid_page);
+    zvec_format scan_page(size_t y, V *src, V *ref, size_t skip,
+                          zvec_stats<V> &stats, zvec_meta<V> &meta);
+    zvec_format find_ref(size_t y, V *src, V *ref, size_t skip,
+                         zvec_format fmt, zvec_meta<V> &meta);
+    bool has_refs(size_t y);
+    void unref_page(size_t y);
+    zvec_aggr<V> reduce_page(size_t y, size_t n, V *tmp);
+    size_t count_page(size_t y, size_t n, V *tmp, V lo, V hi);
+    V* page_data(size_t y, V *tmp);
+    int zone_test(size_t y, V lo, V hi);
+    template <typename F> bool scan_matches(V lo, V hi, I begin, F f);
+    V sum_elements(size_t y, size_t x0, size_t x1, V *tmp);
+    V sum_pages(size_t y0, size_t y1, V *tmp);
+    V page_first(size_t y, V *tmp);
+    template <typename P> I partition_point(P pred);
+
+    page_pin* pin_page(size_t y);
+    void unpin_page(size_t y, page_pin *p);
+    page_pin* alloc_pin();
+    size_t retire_pin(page_pin *p);
+    void reclaim_pins();
+    void free_pins(page_pin *p);
+
     void write_element(size_t y, size_t x, V val);
     V read_element(size_t y, size_t x);
     V* addr_element(size_t y, size_t x);
 
     ref operator[](I idx);
+    V get(I idx);
 };
 
 template <typename V, typename I, size_t Q>
@@ -147,13 +438,29 @@ inline zip_vector<V,I,Q>::zip_vector()
       _slab_limit(0),
       _bmap_data(nullptr),
       _bmap_last(0),
+      _slots(nullptr),
+      _slot_count(0),
+      _slot_hand(0),
+      _active_slot(invalid_slot),
+      _epoch(0),
       _active_page((size_t)-1ll),
       _active_area((size_t)-1ll),
       _count(0),
-      _dirty(false)
+      _dirty(false),
+      _page_pin(nullptr),
+      _pin_retired(nullptr),
+      _pin_free(nullptr),
+      _pin_retired_count(0),
+      _page_zone(nullptr),
+      _page_sum(nullptr),
+      _page_psum(nullptr),
+      _psum_valid(0),
+      _page_decodes(0),
+      _ref_pages(false)
 {
     resize_slab(page_size * 2);
- }
+    set_slots(default_slots);
+}
 
 template <typename V, typename I, size_t Q>
 inline zip_vector<V,I,Q>::zip_vector(I count) : zip_vector()
@@ -164,6 +471,16 @@ inline zip_vector<V,I,Q>::zip_vector(I count) : zip_vector()
 template <typename V, typename I, size_t Q>
 inline zip_vector<V,I,Q>::~zip_vector()
 {
+    for (size_t i = 0; i < _page_count; i++) {
+        free_pins(_page_pin[i].load());
+    }
+    free_pins(_pin_retired.load());
+    free_pins(_pin_free.load());
+    free(_page_psum);
+    free(_page_sum);
+    free(_page_zone);
+    free(_page_pin);
+    free(_slots);
     free(_page_idx);
     free(_slab_ptr);
     free(_bmap_data);
@@ -188,6 +505,19 @@ inline void zip_vector<V,I,Q>::resize(I count)
         _page_count = next_count;
         _page_idx = (page_idx*)realloc(_page_idx, next_size);
         memset((char*)_page_idx + prev_size, 0, next_size - prev_size);
+        _page_pin = (std::atomic<page_pin*>*)realloc((void*)_page_pin,
+            sizeof(std::atomic<page_pin*>) * next_count);
+        memset((void*)(_page_pin + prev_count), 0,
+            sizeof(std::atomic<page_pin*>) * (next_count - prev_count));
+        if (_page_zone) {
+            _page_zone = (page_zone*)realloc(_page_zone, sizeof(page_zone) * next_count);
+            memset(_page_zone + prev_count, 0, sizeof(page_zone) * (next_count - prev_count));
+        }
+        if (_page_sum) {
+            _page_sum = (V*)realloc(_page_sum, sizeof(V) * next_count);
+            _page_psum = (V*)realloc(_page_psum, sizeof(V) * (next_count + 1));
+            memset(_page_sum + prev_count, 0, sizeof(V) * (next_count - prev_count));
+        }
     }
 
     _count = count;
@@ -222,6 +552,7 @@ inline void zip_vector<V,I,Q>::resize_slab(size_t next_limit)
         _slab_ptr = next_slab_ptr;
         _slab_data = next_slab_data;
         _slab_limit = next_limit;
+        _epoch++;
         Trace("resize_slab %zu\n", next_limit);
     }
 }
@@ -352,252 +683,1666 @@ inline void zip_vector<V,I,Q>::dealloc_bitmap(zvec_size size, size_t offset)
 }
 
 template <typename V, typename I, size_t Q>
-inline void zip_vector<V,I,Q>::switch_page(size_t y1)
+_noinline void zip_vector<V,I,Q>::switch_page(size_t y1)
 {
     size_t y0 = _active_page;
-    size_t a = _active_area;
-
-    page_idx prev_idx = y0 < _page_count ? _page_idx[y0] : page_idx{};
-    zvec_format prev_format = prev_idx.format;
-    size_t prev_offset = prev_idx.offset;
-    zvec_codec prev_codec = (zvec_codec)prev_format.codec;
-    zvec_size prev_size = (zvec_size)prev_format.size;
-
-    zvec_stats<V> mod_stats = {};
-    zvec_format mod_format = {};
-    size_t mod_offset = 0;
-    zvec_codec mod_codec = zvec_codec_none;
-    zvec_size mod_size = zvec_size_0;
-    zvec_meta<V> mod_meta;
 
     Trace("switch_page: y0=%zu y1=%zu", y0, y1);
-    Trace("switch_page: index y0=%zd a=%zd format=%s:%zd offset=%zd",
-        y0, a, zvec_codec_name(prev_codec), zvec_size_bits(prev_size), prev_offset);
 
-    if (_dirty)
-    {
-        mod_stats = zvec_block_scan((V*)(_slab_data + a), Q,
-                                          zvec_block_rel_or_abs);
-        mod_format = zvec_block_format(mod_stats);
-        mod_codec = (zvec_codec)mod_format.codec;
-        mod_size = (zvec_size)mod_format.size;
-        mod_meta = zvec_block_metadata(mod_stats);
-
-        Trace("switch_page: scan y0=%zd a=%zd format=%s:%zd "
-            "(amin=%lld amax=%lld dmin=%lld dmax=%lld)", y0, a,
-            zvec_codec_name(mod_codec), zvec_size_bits(mod_size),
-            mod_stats.amin, mod_stats.amax, mod_stats.dmin, mod_stats.dmax);
-
-        if (mod_size == zvec_size_0) {
-            mod_offset = invalid_offset;
-            if (mod_size != prev_size && prev_size != zvec_size_0) {
-                dealloc_slab(prev_size, prev_offset);
-            }
+    if (_active_slot != invalid_slot) {
+        _slots[_active_slot].dirty |= _dirty;
+    }
+    _dirty = false;
+
+    /* switching past the last page flushes and releases all slots */
+    if (y1 >= _page_count) {
+        for (size_t s = 0; s < _slot_count; s++) {
+            release_slot(_slots[s]);
         }
-        else if (mod_size == zvec_max_size) {
-            mod_offset = a;
-            a = invalid_offset;
-            if (mod_size != prev_size && prev_size != zvec_size_0) {
-                dealloc_slab(prev_size, prev_offset);
-            }
+        _active_page = (size_t)-1ll;
+        _active_area = invalid_offset;
+        _active_slot = invalid_slot;
+        return;
+    }
+
+    size_t s = find_slot(y1);
+    if (s == invalid_slot) {
+        s = evict_slot();
+        fill_slot(_slots[s], y1);
+    }
+    _slots[s].used = true;
+
+    _active_slot = s;
+    _active_page = y1;
+    _active_area = _slots[s].area;
+}
+
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::find_slot(size_t y)
+{
+    for (size_t s = 0; s < _slot_count; s++) {
+        if (_slots[s].page == y) return s;
+    }
+    return invalid_slot;
+}
+
+/*
+ * select slot for replacement using the clock algorithm. empty slots are
+ * used first, otherwise the hand sweeps clearing used bits until it finds
+ * a slot that has not been used since the last sweep which is flushed.
+ */
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::evict_slot()
+{
+    for (;;) {
+        size_t s = _slot_hand;
+        _slot_hand = (_slot_hand + 1) % _slot_count;
+        if (_slots[s].page == invalid_page) {
+            return s;
         }
-        else {
-            if (mod_size == prev_size) {
-                mod_offset = prev_offset;
-            } else {
-                mod_offset = alloc_slab(mod_size);
-            }
-            Trace("switch_page: compress y0=%zd a=%zd fmt=%s:%zd dst=%zd",
-                y0, a, zvec_codec_name(mod_codec), zvec_size_bits(mod_size), mod_offset);
-            zvec_block_encode((V*)(_slab_data + a),
-                              (void*)(_slab_data + mod_offset),
-                              Q, mod_format, mod_meta);
-            if (mod_size != prev_size && prev_size != zvec_size_0) {
-                dealloc_slab(prev_size, prev_offset);
-            }
+        if (_slots[s].used) {
+            _slots[s].used = false;
+            continue;
         }
+        Trace("evict_slot: s=%zu y=%zu", s, _slots[s].page);
+        flush_slot(_slots[s]);
+        return s;
+    }
+}
 
-        _page_idx[y0].offset = mod_offset;
-        _page_idx[y0].format = mod_format;
-        _page_idx[y0].meta = mod_meta;
+/*
+ * decompress page into slot. pages that can't be compressed are accessed
+ * in-place in the slab, otherwise they are decompressed into a scratch area
+ * which is owned by the slot and reused for subsequent pages. pages that
+ * other pages refer to are copied so writes don't change the reference.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::fill_slot(page_slot &s, size_t y)
+{
+    page_idx idx = _page_idx[y];
+    zvec_size size = (zvec_size)idx.format.size;
 
-        _dirty = false;
+    if (size == zvec_max_size && !has_refs(y)) {
+        if (!s.inplace && s.area != invalid_offset) {
+            dealloc_slab(zvec_max_size, s.area);
+        }
+        s.area = idx.offset;
+        s.inplace = true;
+        Trace("fill_slot: inplace y=%zd a=%zd fmt=%s:%zd",
+            y, s.area, zvec_codec_name((zvec_codec)idx.format.codec),
+            zvec_size_bits(size));
+    } else {
+        if (s.inplace || s.area == invalid_offset) {
+            s.area = alloc_slab(zvec_max_size);
+        }
+        s.inplace = false;
+        Trace("fill_slot: decompress y=%zd a=%zd fmt=%s:%zd src=%zd",
+            y, s.area, zvec_codec_name((zvec_codec)idx.format.codec),
+            zvec_size_bits(size), idx.offset);
+        load_page(y, (V*)(_slab_data + s.area));
     }
 
-    /*
-     * if last page was accessed or updated inplace we clear active area as
-     * it is still inuse. if it an inplace page changes size then the active
-     * area can be reused, hence we check modified size for dirty pages.
-     */
-    if (prev_codec == zvec_block_abs && prev_size == zvec_max_size &&
-        (!_dirty || (_dirty && mod_codec == zvec_block_abs && mod_size == zvec_max_size))) {
-        a = invalid_offset;
-    }
+    s.page = y;
+    s.dirty = false;
+    _epoch++;
+}
+
+/*
+ * scan and recompress a dirty slot. blocks can transition from compressed
+ * to uncompressed in which case the scratch area becomes the in-place page,
+ * or from uncompressed to compressed in which case the in-place page becomes
+ * the scratch area for the slot.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::flush_slot(page_slot &s)
+{
+    if (!s.dirty) return;
 
-    page_idx next_idx = y1 < _page_count ? _page_idx[y1] : page_idx{};
-    zvec_format next_format = next_idx.format;
-    size_t next_offset = next_idx.offset;
-    zvec_codec next_codec = (zvec_codec)next_format.codec;
-    zvec_size next_size = (zvec_size)next_format.size;
-    zvec_meta<V> next_meta = next_idx.meta;
+    size_t y = s.page, a = s.area;
+    unref_page(y);
 
-    if (y1 < _page_count)
-    {
-        _active_page = y1;
+    page_idx prev_idx = _page_idx[y];
+    zvec_size prev_size = (zvec_size)prev_idx.format.size;
+    size_t prev_offset = prev_idx.offset;
 
-        if (next_size == zvec_max_size) {
-            if (a != invalid_offset) {
-                dealloc_slab(zvec_max_size, a);
-            }
-            a = next_offset;
-            Trace("switch_page: inplace y1=%zd a=%zd fmt=%s:%zd",
-                y1, a, zvec_codec_name(next_codec), zvec_size_bits(next_size));
+    zvec_stats<V> mod_stats;
+    zvec_meta<V> mod_meta;
+    alignas(64) V ref[Q];
+    zvec_format mod_format = scan_page(y, (V*)(_slab_data + a), ref,
+                                       invalid_page, mod_stats, mod_meta);
+    zvec_codec mod_codec = (zvec_codec)mod_format.codec;
+    zvec_size mod_size = (zvec_size)mod_format.size;
+    size_t mod_offset = invalid_offset;
+
+    Trace("flush_slot: scan y=%zd a=%zd format=%s:%zd "
+        "(amin=%g amax=%g dmin=%g dmax=%g)", y, a,
+        zvec_codec_name(mod_codec), zvec_size_bits(mod_size),
+        (double)mod_stats.amin, (double)mod_stats.amax,
+        (double)mod_stats.dmin, (double)mod_stats.dmax);
+
+    if (mod_size == zvec_max_size) {
+        mod_offset = a;
+        if (!s.inplace && prev_size != zvec_size_0) {
+            dealloc_slab(prev_size, prev_offset);
+        }
+        s.inplace = true;
+    }
+    else if (mod_size == zvec_size_0) {
+        if (!s.inplace && prev_size != zvec_size_0) {
+            dealloc_slab(prev_size, prev_offset);
+        }
+        s.inplace = false;
+    }
+    else {
+        if (!s.inplace && mod_size == prev_size) {
+            mod_offset = prev_offset;
         } else {
-            if (a == invalid_offset) {
-                a = alloc_slab(zvec_max_size);
-            }
-            if (next_codec == zvec_codec_none) {
-                Trace("switch_page: zero y1=%zd a=%zd", y1, a)
-                memset(_slab_data + a, 0, Q * sizeof(V));
-            } else {
-                Trace("switch_page: decompress y1=%zd a=%zd fmt=%s:%zd src=%zd",
-                    y1, a, zvec_codec_name(next_codec), zvec_size_bits(next_size),
-                    next_offset);
-                zvec_block_decode((V*)(_slab_data + a),
-                                  (void*)(_slab_data + next_offset),
-                                  Q, next_format, next_meta);
-            }
+            mod_offset = alloc_slab(mod_size);
+        }
+        Trace("flush_slot: compress y=%zd a=%zd fmt=%s:%zd dst=%zd",
+            y, a, zvec_codec_name(mod_codec), zvec_size_bits(mod_size), mod_offset);
+        if (mod_codec == zvec_block_ref) {
+            zvec_block_encode_ref((V*)(_slab_data + a), ref,
+                                  (void*)(_slab_data + mod_offset),
+                                  Q, mod_size, mod_meta.dv);
+        } else {
+            zvec_block_encode((V*)(_slab_data + a),
+                              (void*)(_slab_data + mod_offset),
+                              Q, mod_format, mod_meta);
         }
+        if (!s.inplace && mod_size != prev_size && prev_size != zvec_size_0) {
+            dealloc_slab(prev_size, prev_offset);
+        }
+        s.inplace = false;
     }
 
-    _active_area = a;
+    _page_idx[y] = page_idx { mod_meta, mod_offset, mod_format };
+    if (_page_zone) {
+        _page_zone[y] = page_zone { mod_stats.amin, mod_stats.amax };
+    }
+    if (_page_sum) {
+        _page_sum[y] = zvec_block_reduce_raw((V*)(_slab_data + a), Q).sum;
+        _psum_valid = std::min(_psum_valid, y);
+    }
+    s.dirty = false;
 }
 
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::operator[](I idx)
+inline void zip_vector<V,I,Q>::release_slot(page_slot &s)
 {
-    size_t y = f_page_num(idx), x = f_page_offset(idx);
-    return ref { *this, y, x };
+    if (s.page == invalid_page) return;
+    flush_slot(s);
+    if (!s.inplace && s.area != invalid_offset) {
+        dealloc_slab(zvec_max_size, s.area);
+    }
+    s = page_slot { invalid_page, invalid_offset, false, false, false };
+    _epoch++;
 }
 
+/* release slot without writing back, used when a page is overwritten */
 template <typename V, typename I, size_t Q>
-inline void zip_vector<V,I,Q>::write_element(size_t y, size_t x, V val)
+inline void zip_vector<V,I,Q>::discard_slot(size_t s)
 {
-    if (y != _active_page) switch_page(y);
-    _dirty |= true;
-    ((V*)(_slab_data + _active_area))[x] = val;
+    if (s == _active_slot) {
+        _dirty = false;
+        _active_slot = invalid_slot;
+        _active_page = (size_t)-1ll;
+        _active_area = invalid_offset;
+    }
+    _slots[s].dirty = false;
+    release_slot(_slots[s]);
 }
 
 template <typename V, typename I, size_t Q>
-inline V zip_vector<V,I,Q>::read_element(size_t y, size_t x)
+inline void zip_vector<V,I,Q>::set_slots(size_t count)
 {
-    if (y != _active_page) switch_page(y);
-    return ((V*)(_slab_data + _active_area))[x];
+    assert(count > 0);
+    sync();
+    _slots = (page_slot*)realloc(_slots, sizeof(page_slot) * count);
+    for (size_t s = 0; s < count; s++) {
+        _slots[s] = page_slot { invalid_page, invalid_offset, false, false, false };
+    }
+    _slot_count = count;
+    _slot_hand = 0;
+    _epoch++;
 }
 
 template <typename V, typename I, size_t Q>
-inline V* zip_vector<V,I,Q>::addr_element(size_t y, size_t x)
+inline void zip_vector<V,I,Q>::load_page(size_t y, V *dst)
 {
-    if (y != _active_page) switch_page(y);
-    return ((V*)(_slab_data + _active_area)) + x;
+    page_idx idx = _page_idx[y];
+    zvec_codec codec = (zvec_codec)idx.format.codec;
+    zvec_size size = (zvec_size)idx.format.size;
+
+    if (codec == zvec_codec_none) {
+        memset(dst, 0, page_size);
+    } else if (size == zvec_max_size) {
+        memcpy(dst, _slab_data + idx.offset, page_size);
+    } else if (codec == zvec_block_ref) {
+        alignas(64) V ref[Q];
+        load_page(y - (size_t)idx.meta.iv, ref);
+        zvec_block_decode_ref(dst, ref, (void*)(_slab_data + idx.offset),
+                              Q, size, idx.meta.dv);
+    } else {
+        zvec_block_decode(dst, (void*)(_slab_data + idx.offset),
+                          Q, idx.format, idx.meta);
+    }
 }
 
+/* copy decoded page using the page cache if resident, otherwise the slab */
 template <typename V, typename I, size_t Q>
-inline zip_vector<V,I,Q>::ref::operator V()
+inline void zip_vector<V,I,Q>::copy_page(size_t y, V *dst)
 {
-    return vec.read_element(y, x);
+    size_t s = find_slot(y);
+    if (s != invalid_slot) {
+        memcpy(dst, _slab_data + _slots[s].area, page_size);
+    } else {
+        load_page(y, dst);
+    }
 }
 
 template <typename V, typename I, size_t Q>
-inline V* zip_vector<V,I,Q>::ref::operator&()
+inline void zip_vector<V,I,Q>::store_page(size_t y, V *src, size_t skip)
 {
-    return vec.addr_element(y, x);
+    unref_page(y);
+
+    page_idx prev_idx = _page_idx[y];
+    zvec_size prev_size = (zvec_size)prev_idx.format.size;
+    size_t prev_offset = prev_idx.offset;
+
+    zvec_stats<V> mod_stats;
+    zvec_meta<V> mod_meta;
+    alignas(64) V ref[Q];
+    zvec_format mod_format = scan_page(y, src, ref, skip, mod_stats, mod_meta);
+    zvec_size mod_size = (zvec_size)mod_format.size;
+    size_t mod_offset = invalid_offset;
+
+    if (mod_size != zvec_size_0) {
+        mod_offset = mod_size == prev_size ? prev_offset : alloc_slab(mod_size);
+        if (mod_size == zvec_max_size) {
+            memcpy(_slab_data + mod_offset, src, page_size);
+        } else if (mod_format.codec == zvec_block_ref) {
+            zvec_block_encode_ref(src, ref, (void*)(_slab_data + mod_offset),
+                                  Q, mod_size, mod_meta.dv);
+        } else {
+            zvec_block_encode(src, (void*)(_slab_data + mod_offset),
+                              Q, mod_format, mod_meta);
+        }
+    }
+    if (mod_size != prev_size && prev_size != zvec_size_0) {
+        dealloc_slab(prev_size, prev_offset);
+    }
+
+    Trace("store_page: y=%zd fmt=%s:%zd offset=%zd", y,
+        zvec_codec_name((zvec_codec)mod_format.codec),
+        zvec_size_bits(mod_size), mod_offset);
+
+    _page_idx[y] = page_idx { mod_meta, mod_offset, mod_format };
+    if (_page_zone) {
+        _page_zone[y] = page_zone { mod_stats.amin, mod_stats.amax };
+    }
+    if (_page_sum) {
+        _page_sum[y] = zvec_block_reduce_raw(src, Q).sum;
+        _psum_valid = std::min(_psum_valid, y);
+    }
 }
 
+/*
+ * scan a page and select its format and metadata, returning the statistics
+ * for the zone maps. a reference page is decoded into ref if one is chosen.
+ */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref& zip_vector<V,I,Q>::ref::operator=(V val)
+inline zvec_format zip_vector<V,I,Q>::scan_page(size_t y, V *src, V *ref,
+    size_t skip, zvec_stats<V> &stats, zvec_meta<V> &meta)
 {
-    vec.write_element(y, x, val);
-    return *this;
+    stats = zvec_block_scan(src, Q, zvec_block_rel_or_abs);
+    stats = zvec_block_scan_pfor(src, Q, stats);
+    stats = zvec_block_scan_dict(src, Q, stats);
+    stats = zvec_block_scan_lin(src, Q, stats);
+    stats = zvec_block_scan_dod(src, Q, stats);
+    stats = zvec_block_scan_gcd(src, Q, stats);
+    stats = zvec_block_scan_mini(src, Q, stats);
+    stats = zvec_block_scan_svb(src, Q, stats);
+    meta = zvec_block_metadata(stats, Q);
+    return find_ref(y, src, ref, skip, zvec_block_format(stats, Q), meta);
 }
 
+/*
+ * enable or disable the reference page search. the search decodes and
+ * compares the pages in the reference window on every flush so it is off
+ * by default. pages already stored as references remain readable and are
+ * stored again when the pages they refer to are rewritten.
+ */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::begin()
+inline void zip_vector<V,I,Q>::set_ref_pages(bool enable)
 {
-    return iterator { ref { *this, 0, 0 } };
+    sync();
+    _ref_pages = enable;
 }
 
+/*
+ * search the pages within the reference window before y for one that src
+ * differs from by less than the width of its own format, decoding the best
+ * into ref. references are made to pages that are not references so that
+ * a decode never decodes more than one other page, they are read from the
+ * slab rather than the page cache as that is what a decode will see, and
+ * pages that are being written in place are skipped.
+ */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::end()
+inline zvec_format zip_vector<V,I,Q>::find_ref(size_t y, V *src, V *ref,
+    size_t skip, zvec_format fmt, zvec_meta<V> &meta)
 {
-    return iterator { ref { *this, f_page_num(_count), f_page_offset(_count) } };
+    if (!_ref_pages || !zvec_block_has_ref<V>() || fmt.size == zvec_size_0) {
+        return fmt;
+    }
+
+    alignas(64) V tmp[Q];
+    u32 seen = 0;
+    for (size_t k = 1; k <= zvec_ref_window && k <= y; k++) {
+        size_t r = y - k;
+        if (_page_idx[r].format.codec == zvec_block_ref) {
+            r -= (size_t)_page_idx[r].meta.iv;
+        }
+        if (r == skip || y - r > zvec_ref_window || (seen & (1u << (y - r)))) {
+            continue;
+        }
+        seen |= 1u << (y - r);
+        size_t s = find_slot(r);
+        if (_page_idx[r].format.codec == zvec_codec_none ||
+            (s != invalid_slot && _slots[s].inplace)) {
+            continue;
+        }
+        load_page(r, tmp);
+        V base;
+        zvec_size z = zvec_block_scan_ref(src, tmp, Q, base);
+        if (zvec_size_bits(z) < zvec_size_bits((zvec_size)fmt.size)) {
+            fmt = zvec_format { (u8)zvec_block_ref, (u8)z };
+            meta = zvec_meta<V> { (V)(y - r), base };
+            memcpy(ref, tmp, page_size);
+            if (z == zvec_size_0) break;
+        }
+    }
+    return fmt;
 }
 
+/* true if a page within the reference window after y refers to y */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::ref::operator++()
+inline bool zip_vector<V,I,Q>::has_refs(size_t y)
 {
-    if (++x == Q) {
-        ++y;
-        x = 0;
+    for (size_t z = y + 1; z <= y + zvec_ref_window && z < _page_count; z++) {
+        page_idx idx = _page_idx[z];
+        if (idx.format.codec == zvec_block_ref && z - (size_t)idx.meta.iv == y) {
+            return true;
+        }
     }
-    return *this;
+    return false;
 }
 
+/*
+ * store the pages that refer to page y again before page y is rewritten,
+ * decoding them against its current contents and excluding it as their
+ * reference, so they may refer to another page or use their own format.
+ */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::ref::operator++(int)
+inline void zip_vector<V,I,Q>::unref_page(size_t y)
 {
-    ref q = *this;
-    operator++();
-    return q;
+    alignas(64) V tmp[Q];
+    for (size_t z = y + 1; z <= y + zvec_ref_window && z < _page_count; z++) {
+        page_idx idx = _page_idx[z];
+        if (idx.format.codec == zvec_block_ref && z - (size_t)idx.meta.iv == y) {
+            Trace("unref_page: y=%zd z=%zd", y, z);
+            load_page(z, tmp);
+            store_page(z, tmp, y);
+        }
+    }
 }
 
+/*
+ * pin page for concurrent access. the first thread to pin a page decodes it
+ * into a private buffer while other threads wait for it to become ready.
+ * a pin with no references is being unpinned so the lookup is retried.
+ * the single-threaded active area must be flushed with sync() beforehand.
+ */
 template <typename V, typename I, size_t Q>
-inline bool zip_vector<V,I,Q>::ref::operator==(const typename zip_vector<V,I,Q>::ref &o) const
+inline typename zip_vector<V,I,Q>::page_pin* zip_vector<V,I,Q>::pin_page(size_t y)
 {
-    return std::tie(y, x) == std::tie(o.y, o.x);
+    for (;;) {
+        std::shared_lock<std::shared_mutex> slab_lock(_slab_lock);
+
+        page_pin *p = _page_pin[y].load(std::memory_order_acquire);
+        if (p) {
+            size_t refs = p->refs.load(std::memory_order_relaxed);
+            while (refs > 0 && !p->refs.compare_exchange_weak(refs, refs + 1,
+                std::memory_order_acquire, std::memory_order_relaxed));
+            slab_lock.unlock();
+            if (refs == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            while (p->state.load(std::memory_order_acquire) != pin_ready) {
+                std::this_thread::yield();
+            }
+            return p;
+        }
+
+        assert(find_slot(y) == invalid_slot);
+
+        p = alloc_pin();
+        page_pin *none = nullptr;
+        if (!_page_pin[y].compare_exchange_strong(none, p,
+            std::memory_order_acq_rel)) {
+            retire_pin(p);
+            continue;
+        }
+        load_page(y, p->data);
+        Trace("pin_page: y=%zd", y);
+        p->state.store(pin_ready, std::memory_order_release);
+
+        return p;
+    }
 }
 
+/*
+ * unpin page. the last reference writes back dirty pages with the slab lock
+ * held exclusive, and threads that pin the page in the meantime retry until
+ * it has been removed so they decode the page that was written back.
+ */
 template <typename V, typename I, size_t Q>
-inline bool zip_vector<V,I,Q>::ref::operator!=(const typename zip_vector<V,I,Q>::ref &o) const
+inline void zip_vector<V,I,Q>::unpin_page(size_t y, page_pin *p)
 {
-    return std::tie(y, x) != std::tie(o.y, o.x);
+    if (p->refs.fetch_sub(1, std::memory_order_acq_rel) > 1) return;
+
+    Trace("unpin_page: y=%zd", y);
+    if (p->dirty.load(std::memory_order_relaxed)) {
+        std::unique_lock<std::shared_mutex> slab_lock(_slab_lock);
+        store_page(y, p->data);
+        _page_pin[y].store(nullptr, std::memory_order_release);
+        retire_pin(p);
+        reclaim_pins();
+    } else {
+        _page_pin[y].store(nullptr, std::memory_order_release);
+        if (retire_pin(p) >= retired_pins) {
+            std::unique_lock<std::shared_mutex> slab_lock(_slab_lock);
+            reclaim_pins();
+        }
+    }
+}
+
+/*
+ * take a pin from the free list or allocate a new one. pins are only put
+ * on the free list with the slab lock held exclusive, and are taken with
+ * it held shared, so a pin can't return to the list during a pop. the
+ * link is atomic as a thread holding a stale head reads it while the thread
+ * that popped the pin rewrites it, and the stale compare-exchange fails.
+ */
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::page_pin* zip_vector<V,I,Q>::alloc_pin()
+{
+    page_pin *p = _pin_free.load(std::memory_order_acquire);
+    while (p && !_pin_free.compare_exchange_weak(p,
+        p->next.load(std::memory_order_relaxed), std::memory_order_acquire));
+    if (!p) {
+        p = new page_pin{};
+        p->ptr = (char*)malloc(page_size + 64);
+        p->data = (V*)_align_ptr<char>(p->ptr, 64);
+    }
+    p->refs.store(1, std::memory_order_relaxed);
+    p->state.store(pin_loading, std::memory_order_relaxed);
+    p->dirty.store(false, std::memory_order_relaxed);
+    p->next.store(nullptr, std::memory_order_relaxed);
+    return p;
 }
 
+/* push an unpinned pin on the retired list, returning the list length */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::iterator::operator++()
+inline size_t zip_vector<V,I,Q>::retire_pin(page_pin *p)
 {
-    ++r;
-    return *this;
+    page_pin *head = _pin_retired.load(std::memory_order_relaxed);
+    do {
+        p->next.store(head, std::memory_order_relaxed);
+    } while (!_pin_retired.compare_exchange_weak(head, p,
+        std::memory_order_release, std::memory_order_relaxed));
+    return _pin_retired_count.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
+/* move retired pins to the free list, called with the slab lock exclusive */
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::iterator::operator++(int)
+inline void zip_vector<V,I,Q>::reclaim_pins()
 {
-    ref q = r;
-    ++r;
-    return typename zip_vector<V,I,Q>::iterator { q };
+    page_pin *p = _pin_retired.exchange(nullptr, std::memory_order_acquire);
+    size_t n = 0;
+    while (p) {
+        page_pin *next = p->next.load(std::memory_order_relaxed);
+        p->next.store(_pin_free.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        _pin_free.store(p, std::memory_order_relaxed);
+        p = next, n++;
+    }
+    _pin_retired_count.fetch_sub(n, std::memory_order_relaxed);
 }
 
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::iterator::operator*()
+inline void zip_vector<V,I,Q>::free_pins(page_pin *p)
 {
-    return r;
+    while (p) {
+        page_pin *next = p->next.load(std::memory_order_relaxed);
+        free(p->ptr);
+        delete p;
+        p = next;
+    }
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::operator[](I idx)
+{
+    size_t y = f_page_num(idx), x = f_page_offset(idx);
+    return ref { *this, y, x };
 }
 
 template <typename V, typename I, size_t Q>
-inline typename zip_vector<V,I,Q>::ref * zip_vector<V,I,Q>::iterator::operator->()
+inline void zip_vector<V,I,Q>::write_element(size_t y, size_t x, V val)
 {
-    return &r;
+    if (y != _active_page) switch_page(y);
+    _dirty |= true;
+    ((V*)(_slab_data + _active_area))[x] = val;
 }
 
 template <typename V, typename I, size_t Q>
-inline bool zip_vector<V,I,Q>::iterator::operator==(const typename zip_vector<V,I,Q>::iterator &o) const
+inline V zip_vector<V,I,Q>::read_element(size_t y, size_t x)
 {
-    return r == o.r;
+    if (y != _active_page) switch_page(y);
+    return ((V*)(_slab_data + _active_area))[x];
 }
 
+/*
+ * read an element without switching the active page when the page is
+ * resident, stored in place or its format has random access, such as
+ * elias-fano, narrow absolute and constant pages. other pages are read
+ * through the page cache.
+ */
 template <typename V, typename I, size_t Q>
-inline bool zip_vector<V,I,Q>::iterator::operator!=(const typename zip_vector<V,I,Q>::iterator &o) const
+inline V zip_vector<V,I,Q>::get(I idx)
 {
-    return r != o.r;
+    size_t y = f_page_num(idx), x = f_page_offset(idx);
+    size_t s = find_slot(y);
+    page_idx p = _page_idx[y];
+
+    if (s != invalid_slot) {
+        return ((V*)(_slab_data + _slots[s].area))[x];
+    } else if (p.format.codec == zvec_codec_none) {
+        return 0;
+    } else if ((zvec_size)p.format.size == zvec_max_size) {
+        return ((V*)(_slab_data + p.offset))[x];
+    } else if (zvec_block_has_access<V>(p.format)) {
+        return zvec_block_access((void*)(_slab_data + p.offset), Q,
+                                 p.format, p.meta, x);
+    }
+    return read_element(y, x);
+}
+
+template <typename V, typename I, size_t Q>
+inline V* zip_vector<V,I,Q>::addr_element(size_t y, size_t x)
+{
+    if (y != _active_page) switch_page(y);
+    return ((V*)(_slab_data + _active_area)) + x;
+}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::ref::operator V()
+{
+    return vec.read_element(y, x);
+}
+
+template <typename V, typename I, size_t Q>
+inline V* zip_vector<V,I,Q>::ref::operator&()
+{
+    V* p = vec.addr_element(y, x);
+    vec._dirty = true;
+    return p;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::ref& zip_vector<V,I,Q>::ref::operator=(V val)
+{
+    vec.write_element(y, x, val);
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::ref::operator++()
+{
+    if (++x == Q) {
+        ++y;
+        x = 0;
+    }
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::ref zip_vector<V,I,Q>::ref::operator++(int)
+{
+    ref q = *this;
+    operator++();
+    return q;
+}
+
+template <typename V, typename I, size_t Q>
+inline bool zip_vector<V,I,Q>::ref::operator==(const typename zip_vector<V,I,Q>::ref &o) const
+{
+    return std::tie(y, x) == std::tie(o.y, o.x);
+}
+
+template <typename V, typename I, size_t Q>
+inline bool zip_vector<V,I,Q>::ref::operator!=(const typename zip_vector<V,I,Q>::ref &o) const
+{
+    return std::tie(y, x) != std::tie(o.y, o.x);
+}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::page_ref::operator V() const
+{
+    return epoch == vec->_epoch ? *p : vec->read_element(y, x);
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::page_ref& zip_vector<V,I,Q>::page_ref::operator=(V val)
+{
+    if (epoch != vec->_epoch) {
+        p = vec->addr_element(y, x);
+        s = vec->_active_slot;
+        epoch = vec->_epoch;
+    }
+    vec->_slots[s].dirty = true;
+    *p = val;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::begin()
+{
+    return iterator(this, 0);
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::iterator zip_vector<V,I,Q>::end()
+{
+    return iterator(this, _count);
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::const_iterator zip_vector<V,I,Q>::cbegin()
+{
+    return const_iterator(this, 0);
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::const_iterator zip_vector<V,I,Q>::cend()
+{
+    return const_iterator(this, _count);
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline zip_vector<V,I,Q>::basic_iterator<C>::basic_iterator(zip_vector *vec, I idx)
+    : vec(vec), idx(idx), y(invalid_page), s(invalid_slot),
+      epoch(invalid_epoch), p(nullptr) {}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline V* zip_vector<V,I,Q>::basic_iterator<C>::addr()
+{
+    if (epoch != vec->_epoch) {
+        y = vec->f_page_num(idx);
+        p = vec->addr_element(y, 0);
+        s = vec->_active_slot;
+        epoch = vec->_epoch;
+    }
+    return p + vec->f_page_offset(idx);
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>::reference
+zip_vector<V,I,Q>::basic_iterator<C>::operator*()
+{
+    if constexpr (C) {
+        return *addr();
+    } else {
+        V *a = addr();
+        return page_ref { vec, y, vec->f_page_offset(idx), s, epoch, a };
+    }
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>::reference
+zip_vector<V,I,Q>::basic_iterator<C>::operator[](difference_type n)
+{
+    return *(*this + n);
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>&
+zip_vector<V,I,Q>::basic_iterator<C>::operator++()
+{
+    if (vec->f_page_offset(++idx) == 0) epoch = invalid_epoch;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>
+zip_vector<V,I,Q>::basic_iterator<C>::operator++(int)
+{
+    basic_iterator q = *this;
+    ++*this;
+    return q;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>&
+zip_vector<V,I,Q>::basic_iterator<C>::operator--()
+{
+    if (vec->f_page_offset(idx--) == 0) epoch = invalid_epoch;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>
+zip_vector<V,I,Q>::basic_iterator<C>::operator--(int)
+{
+    basic_iterator q = *this;
+    --*this;
+    return q;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>&
+zip_vector<V,I,Q>::basic_iterator<C>::operator+=(difference_type n)
+{
+    idx += n;
+    if (vec->f_page_num(idx) != y) epoch = invalid_epoch;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>&
+zip_vector<V,I,Q>::basic_iterator<C>::operator-=(difference_type n)
+{
+    idx -= n;
+    if (vec->f_page_num(idx) != y) epoch = invalid_epoch;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>
+zip_vector<V,I,Q>::basic_iterator<C>::operator+(difference_type n) const
+{
+    basic_iterator q = *this;
+    q += n;
+    return q;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>
+zip_vector<V,I,Q>::basic_iterator<C>::operator-(difference_type n) const
+{
+    basic_iterator q = *this;
+    q -= n;
+    return q;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_iterator<C>::difference_type
+zip_vector<V,I,Q>::basic_iterator<C>::operator-(const basic_iterator &o) const
+{
+    return (difference_type)idx - (difference_type)o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator==(const basic_iterator &o) const
+{
+    return idx == o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator!=(const basic_iterator &o) const
+{
+    return idx != o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator<(const basic_iterator &o) const
+{
+    return idx < o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator>(const basic_iterator &o) const
+{
+    return idx > o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator<=(const basic_iterator &o) const
+{
+    return idx <= o.idx;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline bool zip_vector<V,I,Q>::basic_iterator<C>::operator>=(const basic_iterator &o) const
+{
+    return idx >= o.idx;
+}
+
+/*
+ * bulk copy of elements. whole pages are decoded directly into the output
+ * if it is 64-byte aligned, otherwise via a temporary page buffer. partial
+ * pages at the head and tail are copied from the page cache.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::copy_out(I begin, I n, V *dst)
+{
+    char *tmp_ptr = nullptr;
+    V *tmp = nullptr;
+
+    assert(begin + n <= _count);
+
+    while (n > 0) {
+        size_t y = f_page_num(begin), x = f_page_offset(begin);
+        size_t c = std::min((size_t)(Q - x), (size_t)n);
+        if (c == Q && ((uintptr_t)dst & 63) == 0) {
+            copy_page(y, dst);
+        } else if (c == Q) {
+            if (!tmp) {
+                tmp_ptr = (char*)malloc(page_size + 64);
+                tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+            }
+            copy_page(y, tmp);
+            memcpy(dst, tmp, page_size);
+        } else {
+            memcpy(dst, addr_element(y, x), c * sizeof(V));
+        }
+        begin += c;
+        dst += c;
+        n -= c;
+    }
+
+    free(tmp_ptr);
+}
+
+/*
+ * bulk assignment of elements. whole pages are scanned and encoded directly
+ * from the input if it is 64-byte aligned, otherwise via a temporary page
+ * buffer. partial pages at the head and tail are written to the page cache.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::assign(I begin, const V *src, I n)
+{
+    char *tmp_ptr = nullptr;
+    V *tmp = nullptr;
+
+    assert(begin + n <= _count);
+
+    while (n > 0) {
+        size_t y = f_page_num(begin), x = f_page_offset(begin);
+        size_t c = std::min((size_t)(Q - x), (size_t)n);
+        if (c == Q) {
+            size_t s = find_slot(y);
+            if (s != invalid_slot) {
+                discard_slot(s);
+            }
+            if (((uintptr_t)src & 63) == 0) {
+                /* the block codecs do not modify their input */
+                store_page(y, const_cast<V*>(src));
+            } else {
+                if (!tmp) {
+                    tmp_ptr = (char*)malloc(page_size + 64);
+                    tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+                }
+                memcpy(tmp, src, page_size);
+                store_page(y, tmp);
+            }
+        } else {
+            memcpy(addr_element(y, x), src, c * sizeof(V));
+            _dirty = true;
+        }
+        begin += c;
+        src += c;
+        n -= c;
+    }
+
+    free(tmp_ptr);
+}
+
+/*
+ * append element. new pages are zero pages so filling the active slot does
+ * not require decompression. when the last element of a page is written the
+ * slot is sealed, scanning and encoding it directly to its slab block.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::push_back(V val)
+{
+    I idx = _count;
+    if ((size_t)idx >= _page_count * Q) {
+        resize(idx + 1);
+    } else {
+        _count = idx + 1;
+    }
+    size_t y = f_page_num(idx), x = f_page_offset(idx);
+    write_element(y, x, val);
+    if (x == Q - 1) {
+        seal_page();
+    }
+}
+
+template <typename V, typename I, size_t Q>
+template <typename... Args>
+inline void zip_vector<V,I,Q>::emplace_back(Args&&... args)
+{
+    push_back(V(std::forward<Args>(args)...));
+}
+
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::append(const V *src, I n)
+{
+    I begin = _count;
+    resize(begin + n);
+    assign(begin, src, n);
+}
+
+/* scan and encode the active page leaving it resident in the page cache */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::seal_page()
+{
+    if (_active_slot == invalid_slot) return;
+    _slots[_active_slot].dirty |= _dirty;
+    _dirty = false;
+    flush_slot(_slots[_active_slot]);
+    _active_area = _slots[_active_slot].area;
+}
+
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::page_count()
+{
+    return f_page_num(f_page_round(_count));
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::span zip_vector<V,I,Q>::page_span(size_t y)
+{
+    assert(y < page_count());
+    V *p = addr_element(y, 0);
+    _dirty = true;
+    return span { p, std::min((size_t)Q, (size_t)_count - y * Q) };
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::const_span zip_vector<V,I,Q>::page_cspan(size_t y)
+{
+    assert(y < page_count());
+    V *p = addr_element(y, 0);
+    return const_span { p, std::min((size_t)Q, (size_t)_count - y * Q) };
+}
+
+template <typename V, typename I, size_t Q>
+template <typename F>
+inline void zip_vector<V,I,Q>::for_each_page(F f)
+{
+    for (size_t y = 0; y < page_count(); y++) {
+        f(y, page_span(y));
+    }
+}
+
+template <typename V, typename I, size_t Q>
+template <typename F>
+inline void zip_vector<V,I,Q>::for_each_cpage(F f)
+{
+    for (size_t y = 0; y < page_count(); y++) {
+        f(y, page_cspan(y));
+    }
+}
+
+/*
+ * reduce page to sum, min and max. resident pages are reduced from their
+ * slot, compressed pages in the compressed domain using the block format.
+ * a partial last page is reduced over its first n elements only.
+ */
+template <typename V, typename I, size_t Q>
+inline zvec_aggr<V> zip_vector<V,I,Q>::reduce_page(size_t y, size_t n, V *tmp)
+{
+    using U = zvec_accum<V>;
+
+    size_t s = find_slot(y);
+    page_idx idx = _page_idx[y];
+    zvec_size size = (zvec_size)idx.format.size;
+
+    if (n < Q) {
+        copy_page(y, tmp);
+        zvec_aggr<V> r { 0, zvec_highest<V>(), zvec_lowest<V>() };
+        for (size_t x = 0; x < n; x++) {
+            r.sum = (V)((U)r.sum + (U)tmp[x]);
+            r.min = std::min(r.min, tmp[x]);
+            r.max = std::max(r.max, tmp[x]);
+        }
+        return r;
+    } else if (s != invalid_slot) {
+        return zvec_block_reduce_raw((V*)(_slab_data + _slots[s].area), Q);
+    } else if (idx.format.codec == zvec_codec_none) {
+        return zvec_aggr<V> { 0, 0, 0 };
+    } else if (size == zvec_max_size) {
+        return zvec_block_reduce_raw((V*)(_slab_data + idx.offset), Q);
+    } else if (idx.format.codec == zvec_block_ref) {
+        load_page(y, tmp);
+        return zvec_block_reduce_raw(tmp, Q);
+    } else {
+        return zvec_block_reduce(tmp, (void*)(_slab_data + idx.offset),
+                                 Q, idx.format, idx.meta);
+    }
+}
+
+/* count page elements in [lo, hi] */
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::count_page(size_t y, size_t n, V *tmp, V lo, V hi)
+{
+    size_t s = find_slot(y);
+    page_idx idx = _page_idx[y];
+    zvec_size size = (zvec_size)idx.format.size;
+
+    switch (zone_test(y, lo, hi)) {
+    case -1: return 0;
+    case 1: return n;
+    }
+
+    if (n < Q) {
+        copy_page(y, tmp);
+        size_t c = 0;
+        for (size_t x = 0; x < n; x++) {
+            c += tmp[x] >= lo && tmp[x] <= hi;
+        }
+        return c;
+    } else if (s != invalid_slot) {
+        return zvec_block_count_raw((V*)(_slab_data + _slots[s].area), Q, lo, hi);
+    } else if (idx.format.codec == zvec_codec_none) {
+        return lo <= 0 && hi >= 0 ? Q : 0;
+    } else if (size == zvec_max_size) {
+        return zvec_block_count_raw((V*)(_slab_data + idx.offset), Q, lo, hi);
+    } else if (idx.format.codec == zvec_block_ref) {
+        load_page(y, tmp);
+        return zvec_block_count_raw(tmp, Q, lo, hi);
+    } else {
+        return zvec_block_count(tmp, (void*)(_slab_data + idx.offset),
+                                Q, idx.format, idx.meta, lo, hi);
+    }
+}
+
+/*
+ * sum, min and max of all elements. the sum wraps in the element type.
+ * an empty vector returns zero and the min and max identity values.
+ */
+template <typename V, typename I, size_t Q>
+inline zvec_aggr<V> zip_vector<V,I,Q>::aggregate()
+{
+    using U = zvec_accum<V>;
+
+    zvec_aggr<V> r { 0, zvec_highest<V>(), zvec_lowest<V>() };
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    for (size_t y = 0; y < page_count(); y++) {
+        size_t n = std::min((size_t)Q, (size_t)_count - y * Q);
+        zvec_aggr<V> a = reduce_page(y, n, tmp);
+        r.sum = (V)((U)r.sum + (U)a.sum);
+        r.min = std::min(r.min, a.min);
+        r.max = std::max(r.max, a.max);
+    }
+
+    free(tmp_ptr);
+    return r;
+}
+
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::sum()
+{
+    return aggregate().sum;
+}
+
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::min()
+{
+    return aggregate().min;
+}
+
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::max()
+{
+    return aggregate().max;
+}
+
+/* count elements in the closed interval [lo, hi] */
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::count_range(V lo, V hi)
+{
+    size_t c = 0;
+    if (!(lo <= hi)) return 0;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    for (size_t y = 0; y < page_count(); y++) {
+        size_t n = std::min((size_t)Q, (size_t)_count - y * Q);
+        c += count_page(y, n, tmp, lo, hi);
+    }
+
+    free(tmp_ptr);
+    return c;
+}
+
+/* count elements matching a comparison with val, mapped to an interval */
+template <typename V, typename I, size_t Q>
+inline size_t zip_vector<V,I,Q>::count_if(zvec_cmp cmp, V val)
+{
+    const V vmin = zvec_lowest<V>();
+    const V vmax = zvec_highest<V>();
+
+    switch (cmp) {
+    case zvec_cmp_eq: return count_range(val, val);
+    case zvec_cmp_ne: return (size_t)_count - count_range(val, val);
+    case zvec_cmp_lt: return val == vmin ? 0 : count_range(vmin, zvec_prev(val));
+    case zvec_cmp_le: return count_range(vmin, val);
+    case zvec_cmp_gt: return val == vmax ? 0 : count_range(zvec_next(val), vmax);
+    case zvec_cmp_ge: return count_range(val, vmax);
+    }
+    return 0;
+}
+
+/*
+ * enable or disable page zone maps. zone maps are built from the page
+ * contents when enabled and then kept up to date from the block scan
+ * statistics whenever a page is recompressed.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::set_zone_maps(bool enable)
+{
+    sync();
+    if (!enable) {
+        free(_page_zone);
+        _page_zone = nullptr;
+        return;
+    }
+    if (_page_zone) return;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    _page_zone = (page_zone*)malloc(sizeof(page_zone) * (_page_count + 1));
+    for (size_t y = 0; y < _page_count; y++) {
+        zvec_aggr<V> a = reduce_page(y, Q, tmp);
+        _page_zone[y] = page_zone { a.min, a.max };
+    }
+
+    free(tmp_ptr);
+}
+
+/*
+ * test page zone against [lo, hi] returning -1 if no element can match,
+ * 1 if all elements match, or 0 if the page must be scanned. zones are
+ * stale while a page is resident in the page cache so are not used.
+ */
+template <typename V, typename I, size_t Q>
+inline int zip_vector<V,I,Q>::zone_test(size_t y, V lo, V hi)
+{
+    if (!_page_zone || find_slot(y) != invalid_slot) return 0;
+    page_zone z = _page_zone[y];
+    if (z.max < lo || z.min > hi) return -1;
+    /* floating point zones skip NaN so cannot show that all elements match */
+    if (std::is_floating_point<V>::value) return 0;
+    if (z.min >= lo && z.max <= hi) return 1;
+    return 0;
+}
+
+/* decoded page data from the page cache, in-place page, or decoded to tmp */
+template <typename V, typename I, size_t Q>
+inline V* zip_vector<V,I,Q>::page_data(size_t y, V *tmp)
+{
+    size_t s = find_slot(y);
+    page_idx idx = _page_idx[y];
+
+    if (s != invalid_slot) {
+        return (V*)(_slab_data + _slots[s].area);
+    } else if (idx.format.codec != zvec_codec_none &&
+               (zvec_size)idx.format.size == zvec_max_size) {
+        return (V*)(_slab_data + idx.offset);
+    } else {
+        load_page(y, tmp);
+        _page_decodes++;
+        return tmp;
+    }
+}
+
+/*
+ * call f with the index of each element in [lo, hi] from begin, stopping
+ * if f returns false. pages are skipped using zone maps if enabled, the
+ * remainder are matched to a bitmap. f must not modify the vector.
+ */
+template <typename V, typename I, size_t Q>
+template <typename F>
+inline bool zip_vector<V,I,Q>::scan_matches(V lo, V hi, I begin, F f)
+{
+    u64 bits[(Q + 63) >> 6];
+    bool cont = true;
+
+    if (lo > hi || begin >= _count) return true;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    for (size_t y = f_page_num(begin); cont && y < page_count(); y++) {
+        size_t x0 = y == f_page_num(begin) ? f_page_offset(begin) : 0;
+        size_t n = std::min((size_t)Q, (size_t)_count - y * Q);
+        switch (zone_test(y, lo, hi)) {
+        case -1:
+            continue;
+        case 1:
+            for (size_t x = x0; cont && x < n; x++) {
+                cont = f((I)(y * Q + x));
+            }
+            continue;
+        }
+        if (zvec_block_match_raw(page_data(y, tmp), Q, lo, hi, bits) == 0) {
+            continue;
+        }
+        for (size_t w = x0 >> 6; cont && w < ((n + 63) >> 6); w++) {
+            u64 m = bits[w];
+            if (w == (x0 >> 6)) m &= ~0ull << (x0 & 63);
+            while (cont && m) {
+                size_t x = (w << 6) + ctz(m);
+                if (x >= n) break;
+                cont = f((I)(y * Q + x));
+                m &= m - 1;
+            }
+        }
+    }
+
+    free(tmp_ptr);
+    return cont;
+}
+
+/* index of the first element in [lo, hi] from begin, or size() if none */
+template <typename V, typename I, size_t Q>
+inline I zip_vector<V,I,Q>::find_if(V lo, V hi, I begin)
+{
+    I r = _count;
+    scan_matches(lo, hi, begin, [&](I i) { r = i; return false; });
+    return r;
+}
+
+/* call f with the index of each element in [lo, hi] in ascending order */
+template <typename V, typename I, size_t Q>
+template <typename F>
+inline void zip_vector<V,I,Q>::filter(V lo, V hi, F f)
+{
+    scan_matches(lo, hi, 0, [&](I i) { f(i); return true; });
+}
+
+/*
+ * enable or disable the prefix sum index. page sums are computed when a
+ * page is recompressed and the prefix sums are rebuilt lazily by range
+ * queries from the lowest page that has changed since the last query.
+ */
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::set_prefix_index(bool enable)
+{
+    sync();
+    if (!enable) {
+        free(_page_sum);
+        free(_page_psum);
+        _page_sum = _page_psum = nullptr;
+        return;
+    }
+    if (_page_sum) return;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    _page_sum = (V*)malloc(sizeof(V) * (_page_count + 1));
+    _page_psum = (V*)malloc(sizeof(V) * (_page_count + 1));
+    for (size_t y = 0; y < _page_count; y++) {
+        _page_sum[y] = reduce_page(y, Q, tmp).sum;
+    }
+    _psum_valid = 0;
+
+    free(tmp_ptr);
+}
+
+/* sum of elements [x0, x1) within a page */
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::sum_elements(size_t y, size_t x0, size_t x1, V *tmp)
+{
+    using U = zvec_accum<V>;
+
+    V *p = page_data(y, tmp);
+    U sum = 0;
+    for (size_t x = x0; x < x1; x++) {
+        sum += (U)p[x];
+    }
+    return (V)sum;
+}
+
+/*
+ * sum of whole pages [y0, y1). with the prefix index this is a difference
+ * of prefix sums corrected for dirty pages in the page cache, whose page
+ * sums are only updated when they are recompressed.
+ */
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::sum_pages(size_t y0, size_t y1, V *tmp)
+{
+    using U = zvec_accum<V>;
+
+    U sum = 0;
+    if (y0 >= y1) return 0;
+
+    if (!_page_sum) {
+        for (size_t y = y0; y < y1; y++) {
+            sum += (U)reduce_page(y, Q, tmp).sum;
+        }
+        return (V)sum;
+    }
+
+    if (_psum_valid < y1) {
+        if (_psum_valid == 0) _page_psum[0] = 0;
+        for (size_t y = _psum_valid; y < y1; y++) {
+            _page_psum[y + 1] = (V)((U)_page_psum[y] + (U)_page_sum[y]);
+        }
+        _psum_valid = y1;
+    }
+    sum = (U)_page_psum[y1] - (U)_page_psum[y0];
+
+    for (size_t s = 0; s < _slot_count; s++) {
+        size_t y = _slots[s].page;
+        bool dirty = _slots[s].dirty || (s == _active_slot && _dirty);
+        if (y == invalid_page || !dirty || y < y0 || y >= y1) continue;
+        V *p = (V*)(_slab_data + _slots[s].area);
+        sum += (U)zvec_block_reduce_raw(p, Q).sum - (U)_page_sum[y];
+    }
+
+    return (V)sum;
+}
+
+/* sum of n elements from begin. only the boundary pages are decoded */
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::range_sum(I begin, I n)
+{
+    using U = zvec_accum<V>;
+
+    assert(begin + n <= _count);
+    if (n == 0) return 0;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    I end = begin + n;
+    size_t ya = f_page_num(begin), xa = f_page_offset(begin);
+    size_t yb = f_page_num(end), xb = f_page_offset(end);
+    U sum = 0;
+
+    if (ya == yb) {
+        sum = (U)sum_elements(ya, xa, xb, tmp);
+    } else {
+        if (xa > 0) {
+            sum += (U)sum_elements(ya, xa, Q, tmp);
+            ya++;
+        }
+        sum += (U)sum_pages(ya, yb, tmp);
+        if (xb > 0) {
+            sum += (U)sum_elements(yb, 0, xb, tmp);
+        }
+    }
+
+    free(tmp_ptr);
+    return (V)sum;
+}
+
+/*
+ * first element of a page, from the page index for delta and const formats
+ * and from the compressed block for formats that read it without decoding.
+ */
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::page_first(size_t y, V *tmp)
+{
+    size_t s = find_slot(y);
+    page_idx idx = _page_idx[y];
+
+    if (s != invalid_slot) {
+        return ((V*)(_slab_data + _slots[s].area))[0];
+    } else if (idx.format.codec == zvec_codec_none) {
+        return 0;
+    } else if ((zvec_size)idx.format.size == zvec_max_size) {
+        return ((V*)(_slab_data + idx.offset))[0];
+    }
+    switch (idx.format.codec) {
+    case zvec_block_rel:
+    case zvec_block_mono:
+    case zvec_block_ef:
+    case zvec_block_rle:
+    case zvec_block_dict:
+    case zvec_block_xor:
+    case zvec_const_abs:
+        return idx.meta.iv;
+    case zvec_const_rel:
+    case zvec_block_dod:
+        return zvec_series_value(idx.meta.iv, idx.meta.dv, 0);
+    default:
+        if (zvec_block_has_first<V>(idx.format)) {
+            return zvec_block_first((void*)(_slab_data + idx.offset), Q,
+                                    idx.format, idx.meta);
+        }
+        return page_data(y, tmp)[0];
+    }
+}
+
+/*
+ * index of the first element for which pred is false in a vector that is
+ * partitioned by pred. pages are found by binary search on their first
+ * element so only the page containing the partition point is decoded.
+ */
+template <typename V, typename I, size_t Q>
+template <typename P>
+inline I zip_vector<V,I,Q>::partition_point(P pred)
+{
+    size_t l = 0, h = page_count();
+    I r = 0;
+
+    char *tmp_ptr = (char*)malloc(page_size + 64);
+    V *tmp = (V*)_align_ptr<char>(tmp_ptr, 64);
+
+    while (l < h) {
+        size_t m = (l + h) >> 1;
+        if (pred(page_first(m, tmp))) l = m + 1;
+        else h = m;
+    }
+    if (l > 0) {
+        size_t y = l - 1;
+        size_t n = std::min((size_t)Q, (size_t)_count - y * Q);
+        page_idx idx = _page_idx[y];
+        if (find_slot(y) == invalid_slot && idx.format.codec == zvec_block_ef) {
+            /* search elias-fano pages by selecting elements in place */
+            void *comp = (void*)(_slab_data + idx.offset);
+            size_t a = 0, b = n;
+            while (a < b) {
+                size_t m = (a + b) >> 1;
+                if (pred(zvec_block_access(comp, Q, idx.format, idx.meta, m))) a = m + 1;
+                else b = m;
+            }
+            r = (I)(y * Q + a);
+        } else {
+            V *data = page_data(y, tmp);
+            r = (I)(y * Q + (std::partition_point(data, data + n, pred) - data));
+        }
+    }
+
+    free(tmp_ptr);
+    return r;
+}
+
+/* index of the first element not less than val in a sorted vector */
+template <typename V, typename I, size_t Q>
+inline I zip_vector<V,I,Q>::lower_bound(V val)
+{
+    return partition_point([&](V x) { return x < val; });
+}
+
+/* index of the first element greater than val in a sorted vector */
+template <typename V, typename I, size_t Q>
+inline I zip_vector<V,I,Q>::upper_bound(V val)
+{
+    return partition_point([&](V x) { return x <= val; });
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_span<C>::element_type*
+zip_vector<V,I,Q>::basic_span<C>::begin() const
+{
+    return data;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_span<C>::element_type*
+zip_vector<V,I,Q>::basic_span<C>::end() const
+{
+    return data + size;
+}
+
+template <typename V, typename I, size_t Q>
+template <bool C>
+inline typename zip_vector<V,I,Q>::template basic_span<C>::element_type&
+zip_vector<V,I,Q>::basic_span<C>::operator[](size_t i) const
+{
+    return data[i];
+}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::cursor::cursor(zip_vector &vec, I idx)
+    : vec(vec), idx(idx), y(invalid_page)
+{
+    ptr = (char*)malloc(page_size + 64);
+    data = (V*)_align_ptr<char>(ptr, 64);
+}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::cursor::~cursor()
+{
+    free(ptr);
+}
+
+template <typename V, typename I, size_t Q>
+inline const V* zip_vector<V,I,Q>::cursor::page()
+{
+    size_t y1 = vec.f_page_num(idx);
+    if (y1 != y) {
+        vec.copy_page(y1, data);
+        y = y1;
+    }
+    return data;
+}
+
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::cursor::operator*()
+{
+    return page()[vec.f_page_offset(idx)];
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::cursor& zip_vector<V,I,Q>::cursor::operator++()
+{
+    ++idx;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::cursor& zip_vector<V,I,Q>::cursor::operator--()
+{
+    --idx;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::cursor& zip_vector<V,I,Q>::cursor::operator+=(std::ptrdiff_t n)
+{
+    idx += n;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline typename zip_vector<V,I,Q>::cursor& zip_vector<V,I,Q>::cursor::operator-=(std::ptrdiff_t n)
+{
+    idx -= n;
+    return *this;
+}
+
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::cursor::seek(I idx)
+{
+    this->idx = idx;
+}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::accessor::accessor(zip_vector &vec)
+    : vec(vec), y((size_t)-1ll), pin(nullptr) {}
+
+template <typename V, typename I, size_t Q>
+inline zip_vector<V,I,Q>::accessor::~accessor()
+{
+    release();
+}
+
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::accessor::release()
+{
+    if (pin) {
+        vec.unpin_page(y, pin);
+        pin = nullptr;
+        y = (size_t)-1ll;
+    }
+}
+
+template <typename V, typename I, size_t Q>
+inline V zip_vector<V,I,Q>::accessor::get(I idx)
+{
+    size_t y1 = vec.f_page_num(idx), x1 = vec.f_page_offset(idx);
+    if (y1 != y) {
+        release();
+        pin = vec.pin_page(y1);
+        y = y1;
+    }
+    return pin->data[x1];
+}
+
+template <typename V, typename I, size_t Q>
+inline void zip_vector<V,I,Q>::accessor::set(I idx, V val)
+{
+    size_t y1 = vec.f_page_num(idx), x1 = vec.f_page_offset(idx);
+    if (y1 != y) {
+        release();
+        pin = vec.pin_page(y1);
+        y = y1;
+    }
+    pin->dirty.store(true, std::memory_order_relaxed);
+    pin->data[x1] = val;
 }
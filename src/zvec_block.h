@@ -13,6 +13,14 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+/*
+ * block widths are the series 2^k and 3 * 2^(k-1) bits, which
+ * zvec_size_bits computes from the enum value, so each width has a case
+ * in the width dispatch of every codec. widths in between, such as 5, 7
+ * or 10 bits, are not selected even though the packing kernels take any
+ * width and the format size field has room for them.
+ */
+
 enum zvec_size {
     zvec_size_0,
     zvec_size_1,
@@ -36,8 +44,22 @@ static const char* zvec_codec_name(zvec_codec codec)
     case zvec_block_rel: return "block-rel";
     case zvec_block_abs: return "block-abs";
     case zvec_block_rel_or_abs: return "block-rel-or-abs";
+    case zvec_block_mono: return "block-mono";
     case zvec_const_rel: return "const-rel";
     case zvec_const_abs: return "const-abs";
+    case zvec_block_ef: return "block-ef";
+    case zvec_block_for: return "block-for";
+    case zvec_block_pfor: return "block-pfor";
+    case zvec_block_rle: return "block-rle";
+    case zvec_block_dict: return "block-dict";
+    case zvec_block_lin: return "block-lin";
+    case zvec_block_dod: return "block-dod";
+    case zvec_block_gcd: return "block-gcd";
+    case zvec_block_xor: return "block-xor";
+    case zvec_block_decimal: return "block-decimal";
+    case zvec_block_mini: return "block-mini";
+    case zvec_block_svb: return "block-svb";
+    case zvec_block_ref: return "block-ref";
     }
     return nullptr;
 }
@@ -46,6 +68,10 @@ template <typename T>
 constexpr zvec_size zvec_size_abs(zvec_stats<T> s);
 template <typename T>
 constexpr zvec_size zvec_size_rel(zvec_stats<T> s);
+template <typename T>
+constexpr zvec_size zvec_size_mono(zvec_stats<T> s);
+template <typename T>
+constexpr zvec_size zvec_size_for(zvec_stats<T> s);
 
 int zvec_size_bits(zvec_size z)
 {
@@ -57,7 +83,13 @@ template <>
 constexpr zvec_size zvec_size_abs(zvec_stats<i64> s)
 {
     if (s.amin == s.amax) return zvec_size_0;
+    if (s.amin >= -(1<<0) && s.amax <= ((1<<0)-1)) return zvec_size_1;
+    if (s.amin >= -(1<<1) && s.amax <= ((1<<1)-1)) return zvec_size_2;
+    if (s.amin >= -(1<<2) && s.amax <= ((1<<2)-1)) return zvec_size_3;
+    if (s.amin >= -(1<<3) && s.amax <= ((1<<3)-1)) return zvec_size_4;
+    if (s.amin >= -(1<<5) && s.amax <= ((1<<5)-1)) return zvec_size_6;
     if (s.amin >= -(1<<7) && s.amax <= ((1<<7)-1)) return zvec_size_8;
+    if (s.amin >= -(1<<11) && s.amax <= ((1<<11)-1)) return zvec_size_12;
     if (s.amin >= -(1<<15) && s.amax <= ((1<<15)-1)) return zvec_size_16;
     if (s.amin >= -(1<<23) && s.amax <= ((1<<23)-1)) return zvec_size_24;
     if (s.amin >= -(1ll<<31) && s.amax <= ((1ll<<31)-1)) return zvec_size_32;
@@ -69,7 +101,13 @@ template <>
 constexpr zvec_size zvec_size_abs(zvec_stats<u64> s)
 {
     if (s.amin == s.amax) return zvec_size_0;
+    if (s.amax <= ((1u<<1)-1)) return zvec_size_1;
+    if (s.amax <= ((1u<<2)-1)) return zvec_size_2;
+    if (s.amax <= ((1u<<3)-1)) return zvec_size_3;
+    if (s.amax <= ((1u<<4)-1)) return zvec_size_4;
+    if (s.amax <= ((1u<<6)-1)) return zvec_size_6;
     if (s.amax <= ((1u<<8)-1)) return zvec_size_8;
+    if (s.amax <= ((1u<<12)-1)) return zvec_size_12;
     if (s.amax <= ((1u<<16)-1)) return zvec_size_16;
     if (s.amax <= ((1u<<24)-1)) return zvec_size_24;
     if (s.amax <= ((1llu<<32)-1)) return zvec_size_32;
@@ -81,7 +119,13 @@ template <>
 constexpr zvec_size zvec_size_abs(zvec_stats<i32> s)
 {
     if (s.amin == s.amax) return zvec_size_0;
+    if (s.amin >= -(1<<0) && s.amax <= ((1<<0)-1)) return zvec_size_1;
+    if (s.amin >= -(1<<1) && s.amax <= ((1<<1)-1)) return zvec_size_2;
+    if (s.amin >= -(1<<2) && s.amax <= ((1<<2)-1)) return zvec_size_3;
+    if (s.amin >= -(1<<3) && s.amax <= ((1<<3)-1)) return zvec_size_4;
+    if (s.amin >= -(1<<5) && s.amax <= ((1<<5)-1)) return zvec_size_6;
     if (s.amin >= -(1<<7) && s.amax <= ((1<<7)-1)) return zvec_size_8;
+    if (s.amin >= -(1<<11) && s.amax <= ((1<<11)-1)) return zvec_size_12;
     if (s.amin >= -(1<<15) && s.amax <= ((1<<15)-1)) return zvec_size_16;
     if (s.amin >= -(1<<23) && s.amax <= ((1<<23)-1)) return zvec_size_24;
     return zvec_size_32;
@@ -91,17 +135,87 @@ template <>
 constexpr zvec_size zvec_size_abs(zvec_stats<u32> s)
 {
     if (s.amin == s.amax) return zvec_size_0;
+    if (s.amax <= ((1u<<1)-1)) return zvec_size_1;
+    if (s.amax <= ((1u<<2)-1)) return zvec_size_2;
+    if (s.amax <= ((1u<<3)-1)) return zvec_size_3;
+    if (s.amax <= ((1u<<4)-1)) return zvec_size_4;
+    if (s.amax <= ((1u<<6)-1)) return zvec_size_6;
     if (s.amax <= ((1u<<8)-1)) return zvec_size_8;
+    if (s.amax <= ((1u<<12)-1)) return zvec_size_12;
     if (s.amax <= ((1u<<16)-1)) return zvec_size_16;
     if (s.amax <= ((1u<<24)-1)) return zvec_size_24;
     return zvec_size_32;
 }
 
+template <>
+constexpr zvec_size zvec_size_abs(zvec_stats<i16> s)
+{
+    if (s.amin == s.amax) return zvec_size_0;
+    if (s.amin >= -(1<<0) && s.amax <= ((1<<0)-1)) return zvec_size_1;
+    if (s.amin >= -(1<<1) && s.amax <= ((1<<1)-1)) return zvec_size_2;
+    if (s.amin >= -(1<<2) && s.amax <= ((1<<2)-1)) return zvec_size_3;
+    if (s.amin >= -(1<<3) && s.amax <= ((1<<3)-1)) return zvec_size_4;
+    if (s.amin >= -(1<<5) && s.amax <= ((1<<5)-1)) return zvec_size_6;
+    if (s.amin >= -(1<<7) && s.amax <= ((1<<7)-1)) return zvec_size_8;
+    if (s.amin >= -(1<<11) && s.amax <= ((1<<11)-1)) return zvec_size_12;
+    return zvec_size_16;
+}
+
+template <>
+constexpr zvec_size zvec_size_abs(zvec_stats<u16> s)
+{
+    if (s.amin == s.amax) return zvec_size_0;
+    if (s.amax <= ((1u<<1)-1)) return zvec_size_1;
+    if (s.amax <= ((1u<<2)-1)) return zvec_size_2;
+    if (s.amax <= ((1u<<3)-1)) return zvec_size_3;
+    if (s.amax <= ((1u<<4)-1)) return zvec_size_4;
+    if (s.amax <= ((1u<<6)-1)) return zvec_size_6;
+    if (s.amax <= ((1u<<8)-1)) return zvec_size_8;
+    if (s.amax <= ((1u<<12)-1)) return zvec_size_12;
+    return zvec_size_16;
+}
+
+template <>
+constexpr zvec_size zvec_size_abs(zvec_stats<i8> s)
+{
+    if (s.amin == s.amax) return zvec_size_0;
+    if (s.amin >= -(1<<0) && s.amax <= ((1<<0)-1)) return zvec_size_1;
+    if (s.amin >= -(1<<1) && s.amax <= ((1<<1)-1)) return zvec_size_2;
+    if (s.amin >= -(1<<2) && s.amax <= ((1<<2)-1)) return zvec_size_3;
+    if (s.amin >= -(1<<3) && s.amax <= ((1<<3)-1)) return zvec_size_4;
+    if (s.amin >= -(1<<5) && s.amax <= ((1<<5)-1)) return zvec_size_6;
+    return zvec_size_8;
+}
+
+template <>
+constexpr zvec_size zvec_size_abs(zvec_stats<u8> s)
+{
+    if (s.amin == s.amax) return zvec_size_0;
+    if (s.amax <= ((1u<<1)-1)) return zvec_size_1;
+    if (s.amax <= ((1u<<2)-1)) return zvec_size_2;
+    if (s.amax <= ((1u<<3)-1)) return zvec_size_3;
+    if (s.amax <= ((1u<<4)-1)) return zvec_size_4;
+    if (s.amax <= ((1u<<6)-1)) return zvec_size_6;
+    return zvec_size_8;
+}
+
 template <typename T>
 constexpr zvec_size zvec_size_rel(zvec_stats<T> s)
 {
     if (s.dmin == s.dmax) return zvec_size_0;
+    if (s.dmin >= -(1<<0) && s.dmax <= ((1<<0)-1)) return zvec_size_1;
+    if (s.dmin >= -(1<<1) && s.dmax <= ((1<<1)-1)) return zvec_size_2;
+    if (s.dmin >= -(1<<2) && s.dmax <= ((1<<2)-1)) return zvec_size_3;
+    if (s.dmin >= -(1<<3) && s.dmax <= ((1<<3)-1)) return zvec_size_4;
+    if (s.dmin >= -(1<<5) && s.dmax <= ((1<<5)-1)) return zvec_size_6;
+    if constexpr (sizeof(T) == 1) {
+        return zvec_size_8;
+    }
     if (s.dmin >= -(1<<7) && s.dmax <= ((1<<7)-1)) return zvec_size_8;
+    if (s.dmin >= -(1<<11) && s.dmax <= ((1<<11)-1)) return zvec_size_12;
+    if constexpr (sizeof(T) == 2) {
+        return zvec_size_16;
+    }
     if (s.dmin >= -(1<<15) && s.dmax <= ((1<<15)-1)) return zvec_size_16;
     if (s.dmin >= -(1<<23) && s.dmax <= ((1<<23)-1)) return zvec_size_24;
     if constexpr (sizeof(T) == 8) {
@@ -115,6 +229,284 @@ constexpr zvec_size zvec_size_rel(zvec_stats<T> s)
     return zvec_size_0;
 }
 
+/* unsigned deltas of non-decreasing blocks where dmin >= 0 */
+
+template <typename T>
+constexpr zvec_size zvec_size_mono(zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U dmax = (U)s.dmax;
+    if (s.dmin == s.dmax) return zvec_size_0;
+    if (dmax <= ((1u<<1)-1)) return zvec_size_1;
+    if (dmax <= ((1u<<2)-1)) return zvec_size_2;
+    if (dmax <= ((1u<<3)-1)) return zvec_size_3;
+    if (dmax <= ((1u<<4)-1)) return zvec_size_4;
+    if (dmax <= ((1u<<6)-1)) return zvec_size_6;
+    if (dmax <= ((1u<<8)-1)) return zvec_size_8;
+    if (dmax <= ((1u<<12)-1)) return zvec_size_12;
+    if (dmax <= ((1u<<16)-1)) return zvec_size_16;
+    if (dmax <= ((1u<<24)-1)) return zvec_size_24;
+    if constexpr (sizeof(T) == 8) {
+        if (dmax <= ((1llu<<32)-1)) return zvec_size_32;
+        if (dmax <= ((1llu<<48)-1)) return zvec_size_48;
+        return zvec_size_64;
+    }
+    if constexpr (sizeof(T) == 4) {
+        return zvec_size_32;
+    }
+    return zvec_size_0;
+}
+
+/* unsigned offsets from the block minimum for frame of reference blocks */
+
+template <typename T>
+constexpr zvec_size zvec_size_for(zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U range = (U)s.amax - (U)s.amin;
+    if (range == 0) return zvec_size_0;
+    if (range <= ((1u<<1)-1)) return zvec_size_1;
+    if (range <= ((1u<<2)-1)) return zvec_size_2;
+    if (range <= ((1u<<3)-1)) return zvec_size_3;
+    if (range <= ((1u<<4)-1)) return zvec_size_4;
+    if (range <= ((1u<<6)-1)) return zvec_size_6;
+    if (range <= ((1u<<8)-1)) return zvec_size_8;
+    if (range <= ((1u<<12)-1)) return zvec_size_12;
+    if (range <= ((1u<<16)-1)) return zvec_size_16;
+    if (range <= ((1u<<24)-1)) return zvec_size_24;
+    if constexpr (sizeof(T) == 8) {
+        if (range <= ((1llu<<32)-1)) return zvec_size_32;
+        if (range <= ((1llu<<48)-1)) return zvec_size_48;
+        return zvec_size_64;
+    }
+    if constexpr (sizeof(T) == 4) {
+        return zvec_size_32;
+    }
+    return zvec_size_0;
+}
+
+/*
+ * elias-fano sizes are l + 2 bits per element for non-decreasing blocks
+ * that do not wrap so the first value is the minimum. l is the smallest
+ * low bit count where (amax - amin) >> l <= n, limited to the sizes below
+ * 32 bits so that blocks are never mistaken for in place pages.
+ */
+
+template <typename T>
+zvec_size zvec_size_ef(zvec_stats<T> s, size_t n)
+{
+    using U = typename std::make_unsigned<T>::type;
+    if (s.codec != zvec_block_rel_or_abs || s.dmin == s.dmax ||
+        s.dmin < 0 || s.amin != s.iv || (n & 63) != 0) {
+        return zvec_size_0;
+    }
+    U range = (U)s.amax - (U)s.amin;
+    for (zvec_size z : { zvec_size_2, zvec_size_3, zvec_size_4, zvec_size_6,
+                         zvec_size_8, zvec_size_12, zvec_size_16, zvec_size_24 }) {
+        if ((range >> (zvec_size_bits(z) - 2)) <= n) return z;
+    }
+    return zvec_size_0;
+}
+
+/*
+ * patched frame of reference blocks pack offsets from the page minimum at
+ * a width chosen from a histogram of offset widths. offsets that do not
+ * fit keep their low bits in the packed block and their high bits in a
+ * patch list of values followed by u16 positions, applied after decode.
+ * blocks use the smallest size whose length holds both, and the packed
+ * width and patch count are kept in the block delta.
+ */
+
+template <typename T>
+size_t zvec_pfor_bytes(zvec_size z, size_t count, size_t n)
+{
+    return ((zvec_size_bits(z) * n) >> 3) + count * (sizeof(T) + sizeof(u16));
+}
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_pfor(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    s.psize = s.pclass = zvec_size_0, s.pcount = 0;
+    zvec_size size_for = zvec_size_for(s);
+    if ((s.codec != zvec_block_abs && s.codec != zvec_block_rel_or_abs) ||
+        zvec_size_bits(size_for) < 8 || n > 65536) {
+        return s;
+    }
+
+    /* patches needed at each width are suffix sums of the histogram */
+    size_t hist[65] = { 0 };
+    for (size_t i = 0; i < n; i++) {
+        hist[64 - clz_u64((u64)((U)x[i] - (U)s.amin))]++;
+    }
+    for (int w = 63; w >= 0; w--) hist[w] += hist[w + 1];
+
+    zvec_size best = size_for;
+    for (zvec_size p : { zvec_size_0, zvec_size_1, zvec_size_2, zvec_size_3,
+                         zvec_size_4, zvec_size_6, zvec_size_8, zvec_size_12,
+                         zvec_size_16, zvec_size_24, zvec_size_32 }) {
+        int b = zvec_size_bits(p);
+        if (b >= zvec_size_bits(best)) break;
+        size_t count = hist[b + 1];
+        size_t bytes = zvec_pfor_bytes<T>(p, count, n);
+        for (int z = (int)p + 1; z < (int)best; z++) {
+            if ((size_t)zvec_size_bits((zvec_size)z) * n >> 3 >= bytes) {
+                s.psize = (u8)p, s.pclass = (u8)z, s.pcount = (u16)count;
+                best = (zvec_size)z;
+                break;
+            }
+        }
+    }
+    return s;
+}
+
+/*
+ * run-length blocks use the smallest size holding a value and a u16 index
+ * for each run, with runs counted by the block scan. the run count is kept
+ * in the block delta.
+ */
+
+template <typename T>
+zvec_size zvec_size_rle(zvec_stats<T> s, size_t n)
+{
+    if (s.runs <= 1 || n > 65536) return zvec_size_0;
+    size_t bytes = s.runs * (sizeof(T) + sizeof(u16));
+    for (int z = zvec_size_1; z < zvec_size_64; z++) {
+        if ((size_t)zvec_size_bits((zvec_size)z) * n >> 3 >= bytes) {
+            return (zvec_size)z;
+        }
+    }
+    return zvec_size_0;
+}
+
+/*
+ * dictionary blocks pack indices into a sorted table of up to 256 distinct
+ * values that follows the indices. distinct values are found using a small
+ * hash table when pages are stored, and the count is kept in the block delta.
+ */
+
+enum : size_t { zvec_dict_limit = 256 };
+
+template <typename T>
+size_t zvec_block_distinct(T * __restrict x, size_t n, T * __restrict t)
+{
+    using U = typename std::make_unsigned<T>::type;
+    enum : size_t { slots = zvec_dict_limit * 2 };
+    T keys[slots];
+    u64 used[slots / 64] = { 0 };
+    size_t c = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0 && x[i] == x[i - 1]) continue;
+        size_t h = (size_t)(((u64)(U)x[i] * 0x9e3779b97f4a7c15ull) >> 55);
+        while (((used[h >> 6] >> (h & 63)) & 1) && keys[h] != x[i]) {
+            h = (h + 1) & (slots - 1);
+        }
+        if ((used[h >> 6] >> (h & 63)) & 1) continue;
+        if (c == zvec_dict_limit) return c + 1;
+        used[h >> 6] |= 1ull << (h & 63);
+        keys[h] = x[i];
+        t[c++] = x[i];
+    }
+    return c;
+}
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_dict(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    T t[zvec_dict_limit];
+    s.dcount = 0;
+    if ((s.codec != zvec_block_abs && s.codec != zvec_block_rel_or_abs) ||
+        s.amin == s.amax || zvec_size_bits(zvec_size_for(s)) < 3) {
+        return s;
+    }
+    size_t c = zvec_block_distinct(x, n, t);
+    s.dcount = c > zvec_dict_limit ? 0 : (u16)c;
+    return s;
+}
+
+static zvec_size zvec_size_index(size_t count)
+{
+    for (zvec_size z : { zvec_size_1, zvec_size_2, zvec_size_3,
+                         zvec_size_4, zvec_size_6, zvec_size_8 }) {
+        if (((size_t)1 << zvec_size_bits(z)) >= count) return z;
+    }
+    return zvec_size_0;
+}
+
+template <typename T>
+zvec_size zvec_size_dict(zvec_stats<T> s, size_t n)
+{
+    if (s.dcount < 2) return zvec_size_0;
+    size_t bytes = ((zvec_size_bits(zvec_size_index(s.dcount)) * n) >> 3) +
+        s.dcount * sizeof(T);
+    for (int z = zvec_size_1; z < zvec_size_64; z++) {
+        if ((size_t)zvec_size_bits((zvec_size)z) * n >> 3 >= bytes) {
+            return (zvec_size)z;
+        }
+    }
+    return zvec_size_0;
+}
+
+/*
+ * linear blocks hold unsigned residuals from the line iv + (i + 1) * dv,
+ * with the slope rounded from the first and last values and the intercept
+ * lowered by the smallest residual. the line is kept in the block metadata
+ * and is synthesized and added to the residuals on decode.
+ */
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_lin(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    using TS = typename std::make_signed<T>::type;
+    s.lsize = zvec_size_0;
+    if (s.codec != zvec_block_rel_or_abs || s.dmin == s.dmax || n < 2 ||
+        zvec_size_bits(zvec_size_for(s)) <= 2) {
+        return s;
+    }
+    TS d = (TS)((U)x[n - 1] - (U)x[0]), h = (TS)((n - 1) >> 1);
+    TS dv = (d < 0 ? d - h : d + h) / (TS)(n - 1), rmin = 0, rmax = 0;
+    for (size_t i = 1; i < n; i++) {
+        TS r = (TS)((U)x[i] - (U)x[0] - (U)i * (U)dv);
+        rmin = std::min(rmin, r);
+        rmax = std::max(rmax, r);
+    }
+    U range = (U)rmax - (U)rmin;
+    for (zvec_size z : { zvec_size_1, zvec_size_2, zvec_size_3, zvec_size_4,
+                         zvec_size_6, zvec_size_8, zvec_size_12, zvec_size_16 }) {
+        if ((range >> zvec_size_bits(z)) == 0) {
+            s.lsize = (u8)z;
+            s.liv = (T)((U)x[0] + (U)rmin - (U)dv);
+            s.ldv = (T)dv;
+            break;
+        }
+    }
+    return s;
+}
+
+/* element i of a bit-packed block striped across 512-bit rows of U words */
+
+template <typename U>
+U zvec_bits_get(void * __restrict comp, int b, size_t i)
+{
+    constexpr size_t W = sizeof(U) * 8, S = 64 / sizeof(U);
+    U *r = (U*)comp;
+    size_t k = i % S, o = (i / S) * b, w = o / W, sh = o % W;
+    U v = r[w * S + k] >> sh;
+    if (sh + b > W) v |= r[(w + 1) * S + k] << (W - sh);
+    return b >= (int)W ? v : (U)(v & (((U)1 << b) - 1));
+}
+
+template <typename U>
+void zvec_bits_put(void * __restrict comp, int b, size_t i, U v)
+{
+    constexpr size_t W = sizeof(U) * 8, S = 64 / sizeof(U);
+    U *r = (U*)comp;
+    size_t k = i % S, o = (i / S) * b, w = o / W, sh = o % W;
+    r[w * S + k] |= v << sh;
+    if (sh + b > W) r[(w + 1) * S + k] |= v >> (W - sh);
+}
+
 template <typename T>
 zvec_stats<T> zvec_block_scan_abs(T * __restrict x, size_t n)
 {
@@ -128,6 +520,16 @@ zvec_stats<T> zvec_block_scan_abs(T * __restrict x, size_t n)
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         return ops->scan_abs(x, n);
     }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->scan_abs(x, n);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->scan_abs(x, n);
+    }
 }
 
 template <typename T>
@@ -143,6 +545,16 @@ zvec_stats<T> zvec_block_scan_rel(T * __restrict x, size_t n)
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         return ops->scan_rel(x, n);
     }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->scan_rel(x, n);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->scan_rel(x, n);
+    }
 }
 
 template <typename T>
@@ -158,6 +570,16 @@ zvec_stats<T> zvec_block_scan_both(T * __restrict x, size_t n)
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         return ops->scan_both(x, n);
     }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->scan_both(x, n);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->scan_both(x, n);
+    }
 }
 
 template <typename T>
@@ -173,6 +595,16 @@ void zvec_block_synth_abs(T * __restrict x, size_t n, T iv)
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         ops->synth_abs(x, n, iv);
     }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        ops->synth_abs(x, n, iv);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        ops->synth_abs(x, n, iv);
+    }
 }
 
 template <typename T>
@@ -188,6 +620,31 @@ void zvec_block_synth_rel(T * __restrict x, size_t n, T iv, T dv)
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         ops->synth_rel(x, n, iv, dv);
     }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        ops->synth_rel(x, n, iv, dv);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        ops->synth_rel(x, n, iv, dv);
+    }
+}
+
+template <typename T>
+void zvec_block_synth_add(T * __restrict x, size_t n, T iv, T dv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->synth_add(x, n, iv, dv);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->synth_add(x, n, iv, dv);
+    }
 }
 
 template <typename T>
@@ -205,6 +662,96 @@ void zvec_block_synth_both(T * __restrict x, size_t n, T iv, T dv)
     }
 }
 
+template <typename T>
+void zvec_block_delta(T * __restrict x, T * __restrict y, size_t n, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->delta(x, y, n, iv);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->delta(x, y, n, iv);
+    }
+}
+
+template <typename T>
+void zvec_block_integrate(T * __restrict x, size_t n, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->integrate(x, n, iv);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->integrate(x, n, iv);
+    }
+}
+
+template <typename T>
+void zvec_block_scale(T * __restrict x, size_t n, T iv, T g)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->scale(x, n, iv, g);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->scale(x, n, iv, g);
+    }
+}
+
+template <typename T>
+void zvec_block_add(T * __restrict x, T * __restrict y, size_t n)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->add(x, y, n);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->add(x, y, n);
+    }
+}
+
+template <typename T>
+void zvec_block_xor_delta(T * __restrict x, T * __restrict y, size_t n, T iv, int s)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->xor_delta(x, y, n, iv, s);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->xor_delta(x, y, n, iv, s);
+    }
+}
+
+template <typename T>
+void zvec_block_xor_prefix(T * __restrict x, size_t n, T iv, int s)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->xor_prefix(x, n, iv, s);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->xor_prefix(x, n, iv, s);
+    }
+}
+
 template <typename T>
 void zvec_block_encode_abs(T * __restrict in, void * __restrict comp, size_t n, zvec_size z)
 {
@@ -216,132 +763,1229 @@ void zvec_block_encode_abs(T * __restrict in, void * __restrict comp, size_t n,
         typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
-        switch (z) {
-            case zvec_size_0: break;
-            case zvec_size_8: ops->encode_abs_x8(in, (x8*)comp, n); break;
-            case zvec_size_16: ops->encode_abs_x16(in, (x16*)comp, n); break;
-            case zvec_size_24: ops->encode_abs_x24(in, (x24*)comp, n); break;
-            case zvec_size_32: ops->encode_abs_x32(in, (x32*)comp, n); break;
-            case zvec_size_48: ops->encode_abs_x48(in, (x48*)comp, n); break;
-            default: abort(); break;
-        }
+        switch (z) {
+            case zvec_size_0: break;
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_abs_bits(in, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_abs_x8(in, (x8*)comp, n); break;
+            case zvec_size_16: ops->encode_abs_x16(in, (x16*)comp, n); break;
+            case zvec_size_24: ops->encode_abs_x24(in, (x24*)comp, n); break;
+            case zvec_size_32: ops->encode_abs_x32(in, (x32*)comp, n); break;
+            case zvec_size_48: ops->encode_abs_x48(in, (x48*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_0: break;
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_abs_bits(in, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_abs_x8(in, (x8*)comp, n); break;
+            case zvec_size_16: ops->encode_abs_x16(in, (x16*)comp, n); break;
+            case zvec_size_24: ops->encode_abs_x24(in, (x24*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        switch (z) {
+            case zvec_size_0: break;
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_abs_bits(in, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_abs_x8(in, (x8*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        switch (z) {
+            case zvec_size_0: break;
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: ops->encode_abs_bits(in, (u64*)comp, n, zvec_size_bits(z)); break;
+            default: abort(); break;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_decode_abs(T * __restrict out, void * __restrict comp, size_t n, zvec_size z)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_abs_bits(out, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_abs_x8(out, (x8*)comp, n); break;
+            case zvec_size_16: ops->decode_abs_x16(out, (x16*)comp, n); break;
+            case zvec_size_24: ops->decode_abs_x24(out, (x24*)comp, n); break;
+            case zvec_size_32: ops->decode_abs_x32(out, (x32*)comp, n); break;
+            case zvec_size_48: ops->decode_abs_x48(out, (x48*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_abs_bits(out, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_abs_x8(out, (x8*)comp, n); break;
+            case zvec_size_16: ops->decode_abs_x16(out, (x16*)comp, n); break;
+            case zvec_size_24: ops->decode_abs_x24(out, (x24*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_abs_bits(out, (u64*)comp, n, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_abs_x8(out, (x8*)comp, n); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: ops->decode_abs_bits(out, (u64*)comp, n, zvec_size_bits(z)); break;
+            default: abort(); break;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_encode_rel(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_rel_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_rel_x8(in, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->encode_rel_x16(in, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->encode_rel_x24(in, (x24*)comp, n, iv); break;
+            case zvec_size_32: ops->encode_rel_x32(in, (x32*)comp, n, iv); break;
+            case zvec_size_48: ops->encode_rel_x48(in, (x48*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_rel_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_rel_x8(in, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->encode_rel_x16(in, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->encode_rel_x24(in, (x24*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_rel_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_rel_x8(in, (x8*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: ops->encode_rel_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            default: abort(); break;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_decode_rel(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_rel_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_rel_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_rel_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_rel_x24(out, (x24*)comp, n, iv); break;
+            case zvec_size_32: ops->decode_rel_x32(out, (x32*)comp, n, iv); break;
+            case zvec_size_48: ops->decode_rel_x48(out, (x48*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_rel_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_rel_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_rel_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_rel_x24(out, (x24*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_rel_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_rel_x8(out, (x8*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: ops->decode_rel_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            default: abort(); break;
+        }
+    }
+}
+
+/* largest page in bytes for block scratch buffers */
+enum : size_t { zvec_scratch_max = 4096 };
+
+/*
+ * delta-of-delta blocks hold signed second-order deltas packed like
+ * relative blocks. the page index holds the element before the page in iv
+ * and the delta before the page in dv. first-order deltas are computed
+ * into a page-sized buffer and scanned with the relative block scan.
+ */
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_dod(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    alignas(64) T tmp[zvec_scratch_max / sizeof(T)];
+    s.size2 = zvec_size_0;
+    if (s.codec != zvec_block_rel_or_abs || s.dmin == s.dmax || n < 2 ||
+        n > zvec_scratch_max / sizeof(T) || zvec_size_bits(zvec_size_rel(s)) <= 2) {
+        return s;
+    }
+    T iv = (T)(x[0] - (x[1] - x[0]));
+    zvec_block_delta(x, tmp, n, iv);
+    zvec_stats<T> s2 = zvec_block_scan_rel(tmp, n);
+    if (s2.dmin != s2.dmax) {
+        s.size2 = (u8)zvec_size_rel(s2);
+        s.iv2 = iv;
+        s.dv2 = s2.iv;
+    }
+    return s;
+}
+
+template <typename T>
+void zvec_block_encode_dod(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    alignas(64) T tmp[zvec_scratch_max / sizeof(T)];
+    zvec_block_delta(in, tmp, n, iv);
+    zvec_block_encode_rel(tmp, comp, n, z, dv);
+}
+
+template <typename T>
+void zvec_block_decode_dod(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    zvec_block_decode_rel(out, comp, n, z, dv);
+    zvec_block_integrate(out, n, iv);
+}
+
+template <typename T>
+void zvec_block_decode_mono(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_mono_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_mono_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_mono_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_mono_x24(out, (x24*)comp, n, iv); break;
+            case zvec_size_32: ops->decode_mono_x32(out, (x32*)comp, n, iv); break;
+            case zvec_size_48: ops->decode_mono_x48(out, (x48*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_mono_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_mono_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_mono_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_mono_x24(out, (x24*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_encode_for(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_for_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_for_x8(in, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->encode_for_x16(in, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->encode_for_x24(in, (x24*)comp, n, iv); break;
+            case zvec_size_32: ops->encode_for_x32(in, (x32*)comp, n, iv); break;
+            case zvec_size_48: ops->encode_for_x48(in, (x48*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->encode_for_bits(in, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->encode_for_x8(in, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->encode_for_x16(in, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->encode_for_x24(in, (x24*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_decode_for(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_for_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_for_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_for_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_for_x24(out, (x24*)comp, n, iv); break;
+            case zvec_size_32: ops->decode_for_x32(out, (x32*)comp, n, iv); break;
+            case zvec_size_48: ops->decode_for_x48(out, (x48*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        switch (z) {
+            case zvec_size_1: case zvec_size_2: case zvec_size_3: case zvec_size_4:
+            case zvec_size_6: case zvec_size_12: ops->decode_for_bits(out, (u64*)comp, n, iv, zvec_size_bits(z)); break;
+            case zvec_size_8: ops->decode_for_x8(out, (x8*)comp, n, iv); break;
+            case zvec_size_16: ops->decode_for_x16(out, (x16*)comp, n, iv); break;
+            case zvec_size_24: ops->decode_for_x24(out, (x24*)comp, n, iv); break;
+            default: abort(); break;
+        }
+    }
+}
+
+/*
+ * common divisor blocks hold frame of reference offsets divided by the
+ * greatest common divisor of the offsets, which is kept in the page index.
+ * aligned pointers, prices in cents and rounded timestamps lose the low
+ * bits that are always zero. decode widens the quotients with the frame
+ * of reference kernels and then scales them, by a shift for powers of two.
+ */
+
+template <typename U>
+U zvec_gcd(U a, U b)
+{
+    while (b != 0) {
+        U t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_gcd(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    s.gsize = zvec_size_0;
+    if (s.codec != zvec_block_rel_or_abs || s.amin == s.amax ||
+        n > zvec_scratch_max / sizeof(T)) {
+        return s;
+    }
+    U g = 0;
+    for (size_t i = 0; i < n; i++) {
+        g = zvec_gcd(g, (U)((U)x[i] - (U)s.amin));
+        if (g == 1) return s;
+    }
+    zvec_stats<T> q = s;
+    q.amin = 0;
+    q.amax = (T)(((U)s.amax - (U)s.amin) / g);
+    s.gsize = (u8)zvec_size_for(q);
+    s.gdiv = (T)g;
+    return s;
+}
+
+template <typename T>
+void zvec_block_encode_gcd(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv, T g)
+{
+    using U = typename std::make_unsigned<T>::type;
+    alignas(64) T tmp[zvec_scratch_max / sizeof(T)];
+    for (size_t i = 0; i < n; i++) {
+        tmp[i] = (T)(((U)in[i] - (U)iv) / (U)g);
+    }
+    zvec_block_encode_for(tmp, comp, n, z, (T)0);
+}
+
+template <typename T>
+void zvec_block_decode_gcd(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv, T g)
+{
+    zvec_block_decode_for(out, comp, n, z, (T)0);
+    zvec_block_scale(out, n, iv, g);
+}
+
+/*
+ * mini blocks split a page into runs of 64 elements that each have their
+ * own width, so a burst only widens the run that holds it. runs hold
+ * unsigned offsets from their minimum or signed deltas from their first
+ * element, packed with the byte-wide kernels so that every run stays
+ * 64-byte aligned. the run bases and a header byte for each run with its
+ * codec and size are stored at the end of the block, and the block size
+ * is the smallest size holding the runs and the header.
+ */
+
+enum : size_t { zvec_mini_lanes = 64 };
+
+template <typename T>
+zvec_size zvec_mini_size_for(typename std::make_unsigned<T>::type r)
+{
+    if (r == 0) return zvec_size_0;
+    for (zvec_size z : { zvec_size_8, zvec_size_16, zvec_size_24,
+                         zvec_size_32, zvec_size_48 }) {
+        int b = zvec_size_bits(z);
+        if (b < (int)sizeof(T) * 8 && ((u64)r >> b) == 0) return z;
+    }
+    return sizeof(T) == 8 ? zvec_size_64 : zvec_size_32;
+}
+
+template <typename T>
+zvec_size zvec_mini_size_rel(typename std::make_signed<T>::type dmin,
+    typename std::make_signed<T>::type dmax)
+{
+    for (zvec_size z : { zvec_size_8, zvec_size_16, zvec_size_24,
+                         zvec_size_32, zvec_size_48 }) {
+        int b = zvec_size_bits(z);
+        if (b < (int)sizeof(T) * 8 && (i64)dmin >= -((i64)1 << (b - 1)) &&
+            (i64)dmax < ((i64)1 << (b - 1))) return z;
+    }
+    return zvec_size_0;
+}
+
+/* header byte and base of a run, ties prefer offsets which can be read */
+
+template <typename T>
+u8 zvec_mini_format(T * __restrict x, T &base)
+{
+    using U = typename std::make_unsigned<T>::type;
+    using TS = typename std::make_signed<T>::type;
+    T amin = x[0], amax = x[0];
+    TS dmin = 0, dmax = 0;
+    for (size_t i = 1; i < zvec_mini_lanes; i++) {
+        TS d = (TS)((U)x[i] - (U)x[i - 1]);
+        amin = std::min(amin, x[i]), amax = std::max(amax, x[i]);
+        dmin = std::min(dmin, d), dmax = std::max(dmax, d);
+    }
+    zvec_size size_for = zvec_mini_size_for<T>((U)amax - (U)amin);
+    zvec_size size_rel = zvec_mini_size_rel<T>(dmin, dmax);
+    if (size_rel != zvec_size_0 && size_rel < size_for) {
+        base = x[0];
+        return (u8)(zvec_block_rel << 4 | size_rel);
+    }
+    base = amin;
+    return (u8)(zvec_block_for << 4 | size_for);
+}
+
+static size_t zvec_mini_bytes(u8 h)
+{
+    return (zvec_size_bits((zvec_size)(h & 15)) * zvec_mini_lanes) >> 3;
+}
+
+/*
+ * the header and bases are at offsets from the end of the block. bases
+ * are not aligned to their size so they are read and written with memcpy.
+ */
+
+static size_t zvec_mini_header(size_t n, zvec_size z)
+{
+    return ((zvec_size_bits(z) * n) >> 3) - n / zvec_mini_lanes;
+}
+
+template <typename T>
+size_t zvec_mini_bases(size_t n, zvec_size z)
+{
+    return zvec_mini_header(n, z) - n / zvec_mini_lanes * sizeof(T);
+}
+
+template <typename T>
+T zvec_mini_get_base(void * __restrict comp, size_t n, zvec_size z, size_t j)
+{
+    T base;
+    memcpy(&base, (char*)comp + zvec_mini_bases<T>(n, z) + j * sizeof(T), sizeof(T));
+    return base;
+}
+
+template <typename T>
+void zvec_mini_set_base(void * __restrict comp, size_t n, zvec_size z, size_t j, T base)
+{
+    memcpy((char*)comp + zvec_mini_bases<T>(n, z) + j * sizeof(T), &base, sizeof(T));
+}
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_mini(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    s.msize = zvec_size_0;
+    if (s.codec != zvec_block_rel_or_abs || s.amin == s.amax ||
+        n % zvec_mini_lanes != 0) {
+        return s;
+    }
+    T base;
+    size_t bytes = n / zvec_mini_lanes * (sizeof(T) + 1);
+    for (size_t i = 0; i < n; i += zvec_mini_lanes) {
+        bytes += zvec_mini_bytes(zvec_mini_format(x + i, base));
+    }
+    for (int z = zvec_size_1; z < zvec_size_64; z++) {
+        if ((size_t)zvec_size_bits((zvec_size)z) * n >> 3 >= bytes) {
+            s.msize = (u8)z;
+            break;
+        }
+    }
+    return s;
+}
+
+template <typename T>
+void zvec_block_encode_mini(T * __restrict in, void * __restrict comp, size_t n, zvec_size z)
+{
+    size_t o = 0, ho = zvec_mini_header(n, z);
+    for (size_t j = 0; j < n / zvec_mini_lanes; j++) {
+        T *x = in + j * zvec_mini_lanes, base;
+        char *p = (char*)comp + o;
+        u8 h = zvec_mini_format(x, base);
+        zvec_size r = (zvec_size)(h & 15);
+        if (zvec_size_bits(r) == sizeof(T) * 8) {
+            memcpy(p, x, zvec_mini_lanes * sizeof(T));
+        } else if ((h >> 4) == zvec_block_rel) {
+            zvec_block_encode_rel(x, p, zvec_mini_lanes, r, base);
+        } else if (r != zvec_size_0) {
+            zvec_block_encode_for(x, p, zvec_mini_lanes, r, base);
+        }
+        ((u8*)comp)[ho + j] = h;
+        zvec_mini_set_base(comp, n, z, j, base);
+        o += zvec_mini_bytes(h);
+    }
+}
+
+/*
+ * the base is read from its slot here rather than in the caller's loop
+ * where gcc -O2 rewrites the base address so the decode call is dropped.
+ */
+
+template <typename T>
+void zvec_mini_decode(T * __restrict out, char * __restrict p, u8 h, char *b)
+{
+    zvec_size r = (zvec_size)(h & 15);
+    T base;
+    memcpy(&base, b, sizeof(T));
+    if (r == zvec_size_0) {
+        zvec_block_synth_abs(out, zvec_mini_lanes, base);
+    } else if (zvec_size_bits(r) == sizeof(T) * 8) {
+        memcpy(out, p, zvec_mini_lanes * sizeof(T));
+    } else if ((h >> 4) == zvec_block_rel) {
+        zvec_block_decode_rel(out, p, zvec_mini_lanes, r, base);
+    } else {
+        zvec_block_decode_for(out, p, zvec_mini_lanes, r, base);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_mini(T * __restrict out, void * __restrict comp, size_t n, zvec_size z)
+{
+    char *p = (char*)comp, *b = p + zvec_mini_bases<T>(n, z);
+    u8 *h = (u8*)comp + zvec_mini_header(n, z);
+    for (size_t j = 0; j < n / zvec_mini_lanes; j++) {
+        zvec_mini_decode(out + j * zvec_mini_lanes, p, h[j], b + j * sizeof(T));
+        p += zvec_mini_bytes(h[j]);
+    }
+}
+
+/* offsets are read in place, runs of deltas are decoded on the stack */
+
+template <typename T>
+T zvec_block_access_mini(void * __restrict comp, size_t n, zvec_size z, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    u8 *h = (u8*)comp + zvec_mini_header(n, z);
+    size_t j = i / zvec_mini_lanes, k = i % zvec_mini_lanes, o = 0;
+    for (size_t l = 0; l < j; l++) o += zvec_mini_bytes(h[l]);
+    char *p = (char*)comp + o;
+    T base = zvec_mini_get_base<T>(comp, n, z, j);
+    if ((h[j] >> 4) == zvec_block_rel) {
+        alignas(64) T tmp[zvec_mini_lanes];
+        zvec_mini_decode(tmp, p, h[j], (char*)&base);
+        return tmp[k];
+    }
+    size_t w = zvec_size_bits((zvec_size)(h[j] & 15)) >> 3;
+    U v = 0;
+    memcpy(&v, p + k * w, w);
+    return w == sizeof(T) ? (T)v : (T)((U)base + v);
+}
+
+/*
+ * stream vbyte blocks hold unsigned offsets from the page minimum in 1 to
+ * 4 or 8 bytes each, which suits heavy-tailed values that are mostly small
+ * with a few that are large. the minimum is kept in the page index, and
+ * the block size is the smallest size holding both streams and padding.
+ */
+
+template <typename T>
+unsigned zvec_svb_code(typename std::make_unsigned<T>::type o)
+{
+    if (sizeof(T) == 8) {
+        return (u64)o >> 8 == 0 ? 0 : (u64)o >> 16 == 0 ? 1 : (u64)o >> 32 == 0 ? 2 : 3;
+    } else {
+        return (u64)o >> 8 == 0 ? 0 : (u64)o >> 16 == 0 ? 1 : (u64)o >> 24 == 0 ? 2 : 3;
+    }
+}
+
+template <typename T>
+zvec_stats<T> zvec_block_scan_svb(T * __restrict x, size_t n, zvec_stats<T> s)
+{
+    using U = typename std::make_unsigned<T>::type;
+    s.vsize = zvec_size_0;
+    if (s.codec != zvec_block_rel_or_abs || s.amin == s.amax || n % 4 != 0) {
+        return s;
+    }
+    size_t bytes = n / 4 + 16;
+    for (size_t i = 0; i < n; i++) {
+        bytes += zvec_svb_len<T>(zvec_svb_code<T>((U)x[i] - (U)s.amin));
+    }
+    for (int z = zvec_size_1; z < zvec_size_64; z++) {
+        if ((size_t)zvec_size_bits((zvec_size)z) * n >> 3 >= bytes) {
+            s.vsize = (u8)z;
+            break;
+        }
+    }
+    return s;
+}
+
+template <typename T>
+void zvec_block_encode_svb(T * __restrict in, void * __restrict comp, size_t n, T iv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    u8 *c = (u8*)comp, *p = c + n / 4;
+    memset(c, 0, n / 4);
+    for (size_t i = 0; i < n; i++) {
+        U o = (U)in[i] - (U)iv;
+        unsigned k = zvec_svb_code<T>(o);
+        c[i >> 2] |= (u8)(k << ((i & 3) << 1));
+        memcpy(p, &o, zvec_svb_len<T>(k));
+        p += zvec_svb_len<T>(k);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_svb(T * __restrict out, void * __restrict comp, size_t n, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->decode_svb(out, (u8*)comp, n, iv);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->decode_svb(out, (u8*)comp, n, iv);
+    }
+}
+
+/* the data offset of an element sums the lengths of the codes before it */
+
+template <typename T>
+T zvec_block_access_svb(void * __restrict comp, size_t n, T iv, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    const zvec_svb_table<T> &t = zvec_svb_tables<T>();
+    u8 *c = (u8*)comp, *p = c + n / 4;
+    size_t j = 0;
+    for (; j + zvec_svb_table<T>::K <= i; j += zvec_svb_table<T>::K) {
+        p += t.len[sizeof(T) == 4 ? c[j >> 2] : (c[j >> 2] >> ((j & 2) << 1)) & 15];
+    }
+    for (; j < i; j++) {
+        p += zvec_svb_len<T>((c[j >> 2] >> ((j & 3) << 1)) & 3);
+    }
+    U o = 0;
+    memcpy(&o, p, zvec_svb_len<T>((c[i >> 2] >> ((i & 3) << 1)) & 3));
+    return (T)((U)iv + o);
+}
+
+/*
+ * reference blocks hold the lane-wise differences of a page from the
+ * decoded values of an earlier page, so a page that repeats an earlier
+ * page with small changes packs to the width of the changes, and a repeat
+ * or a shifted repeat needs no block at all. the differences are offsets
+ * from their minimum packed as frame of reference. the page index holds
+ * the distance to the reference page, which the caller decodes before the
+ * differences are added to it. references are searched for within a small
+ * window of pages and only 64-bit and 32-bit integer types use them.
+ */
+
+enum : size_t { zvec_ref_window = 4 };
+
+template <typename T>
+constexpr bool zvec_block_has_ref()
+{
+    return std::is_integral<T>::value && sizeof(T) >= 4;
+}
+
+template <typename T>
+zvec_size zvec_block_scan_ref(T * __restrict x, T * __restrict r, size_t n, T &base)
+{
+    if constexpr (zvec_block_has_ref<T>()) {
+        using U = typename std::make_unsigned<T>::type;
+        using S = typename std::make_signed<T>::type;
+        if (n > zvec_scratch_max / sizeof(T)) return zvec_size_64;
+        alignas(64) S tmp[zvec_scratch_max / sizeof(T)];
+        for (size_t i = 0; i < n; i++) {
+            tmp[i] = (S)((U)x[i] - (U)r[i]);
+        }
+        zvec_stats<S> s = zvec_block_scan_abs(tmp, n);
+        base = (T)s.amin;
+        return zvec_size_for(s);
+    }
+    return zvec_size_64;
+}
+
+template <typename T>
+void zvec_block_encode_ref(T * __restrict in, T * __restrict r, void * __restrict comp, size_t n, zvec_size z, T base)
+{
+    if constexpr (zvec_block_has_ref<T>()) {
+        using U = typename std::make_unsigned<T>::type;
+        alignas(64) T tmp[zvec_scratch_max / sizeof(T)];
+        for (size_t i = 0; i < n; i++) {
+            tmp[i] = (T)((U)in[i] - (U)r[i]);
+        }
+        zvec_block_encode_for(tmp, comp, n, z, base);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_ref(T * __restrict out, T * __restrict r, void * __restrict comp, size_t n, zvec_size z, T base)
+{
+    if constexpr (zvec_block_has_ref<T>()) {
+        if (z == zvec_size_0) {
+            zvec_block_synth_abs(out, n, base);
+        } else {
+            zvec_block_decode_for(out, comp, n, z, base);
+        }
+        zvec_block_add(out, r, n);
+    }
+}
+
+template <typename T>
+void zvec_block_encode_ef(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->encode_ef(in, (u64*)comp, n, iv, zvec_size_bits(z) - 2);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->encode_ef(in, (u64*)comp, n, iv, zvec_size_bits(z) - 2);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_ef(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->decode_ef(out, (u64*)comp, n, iv, zvec_size_bits(z) - 2);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->decode_ef(out, (u64*)comp, n, iv, zvec_size_bits(z) - 2);
+    }
+}
+
+template <typename T>
+T zvec_block_select_ef(void * __restrict comp, size_t n, zvec_size z, T iv, size_t i)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        return ops->select_ef((u64*)comp, n, iv, zvec_size_bits(z) - 2, i);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        return ops->select_ef((u64*)comp, n, iv, zvec_size_bits(z) - 2, i);
+    }
+}
+
+template <typename T>
+void zvec_block_encode_pfor(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    zvec_size p = (zvec_size)((U)dv & 0xff);
+    size_t count = (size_t)((U)dv >> 8), j = 0;
+    int b = zvec_size_bits(p);
+    T *patch = (T*)((char*)comp + ((b * n) >> 3));
+    u16 *pos = (u16*)(patch + count);
+    U mask = b == 0 ? 0 : (U)~(U)0 >> (sizeof(T) * 8 - b);
+    if (p != zvec_size_0) {
+        zvec_block_encode_for(in, comp, n, p, iv);
+    }
+    for (size_t i = 0; i < n; i++) {
+        U o = (U)in[i] - (U)iv;
+        if (o > mask) {
+            patch[j] = (T)(o >> b);
+            pos[j++] = (u16)i;
+        }
+    }
+}
+
+template <typename T>
+void zvec_block_decode_pfor(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    zvec_size p = (zvec_size)((U)dv & 0xff);
+    size_t count = (size_t)((U)dv >> 8);
+    int b = zvec_size_bits(p);
+    T *patch = (T*)((char*)comp + ((b * n) >> 3));
+    u16 *pos = (u16*)(patch + count);
+    if (p != zvec_size_0) {
+        zvec_block_decode_for(out, comp, n, p, iv);
+    } else {
+        zvec_block_synth_abs(out, n, iv);
+    }
+    for (size_t j = 0; j < count; j++) {
+        out[pos[j]] = (T)((U)out[pos[j]] + ((U)patch[j] << b));
+    }
+}
+
+template <typename T>
+void zvec_block_encode_rle(T * __restrict in, void * __restrict comp, size_t n, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    T *v = (T*)comp;
+    u16 *e = (u16*)(v + (U)dv);
+    size_t j = 0;
+    for (size_t i = 1; i < n; i++) {
+        if (in[i] != in[i - 1]) {
+            v[j] = in[i - 1];
+            e[j++] = (u16)(i - 1);
+        }
+    }
+    v[j] = in[n - 1];
+    e[j] = (u16)(n - 1);
+}
+
+template <typename T>
+void zvec_block_decode_rle(T * __restrict out, void * __restrict comp, size_t n, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    T *v = (T*)comp;
+    u16 *e = (u16*)(v + (U)dv);
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->decode_rle(out, v, e, (U)dv);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->decode_rle(out, v, e, (U)dv);
+    }
+}
+
+/* sums and ranges of run-length blocks from the runs */
+
+template <typename T>
+zvec_aggr<T> zvec_block_reduce_rle(void * __restrict comp, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    T *v = (T*)comp;
+    u16 *e = (u16*)(v + (U)dv);
+    U sum = 0;
+    T min = v[0], max = v[0];
+    for (size_t j = 0; j < (U)dv; j++) {
+        size_t len = (size_t)e[j] + 1 - (j ? (size_t)e[j - 1] + 1 : 0);
+        sum += (U)v[j] * (U)len;
+        min = std::min(min, v[j]);
+        max = std::max(max, v[j]);
+    }
+    return zvec_aggr<T>{ (T)sum, min, max };
+}
+
+template <typename T>
+size_t zvec_block_count_rle(void * __restrict comp, T dv, T lo, T hi)
+{
+    using U = typename std::make_unsigned<T>::type;
+    T *v = (T*)comp;
+    u16 *e = (u16*)(v + (U)dv);
+    size_t c = 0;
+    for (size_t j = 0; j < (U)dv; j++) {
+        if (v[j] >= lo && v[j] <= hi) {
+            c += (size_t)e[j] + 1 - (j ? (size_t)e[j - 1] + 1 : 0);
+        }
+    }
+    return c;
+}
+
+template <typename T>
+T zvec_block_access_rle(void * __restrict comp, T dv, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    T *v = (T*)comp;
+    u16 *e = (u16*)(v + (U)dv);
+    size_t l = 0, h = (U)dv - 1;
+    while (l < h) {
+        size_t m = (l + h) >> 1;
+        if (e[m] < i) l = m + 1;
+        else h = m;
+    }
+    return v[l];
+}
+
+template <typename T>
+void zvec_block_encode_dict(T * __restrict in, void * __restrict comp, size_t n, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    size_t count = (U)dv;
+    int b = zvec_size_bits(zvec_size_index(count));
+    T *t = (T*)((char*)comp + ((b * n) >> 3));
+    zvec_block_distinct(in, n, t);
+    std::sort(t, t + count);
+    memset(comp, 0, (b * n) >> 3);
+    for (size_t i = 0; i < n; i++) {
+        U k = (U)(std::lower_bound(t, t + count, in[i]) - t);
+        if (b == 8) ((u8*)comp)[i] = (u8)k;
+        else zvec_bits_put<U>(comp, b, i, k);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_dict(T * __restrict out, void * __restrict comp, size_t n, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    size_t count = (U)dv;
+    zvec_size z = zvec_size_index(count);
+    T *t = (T*)((char*)comp + ((zvec_size_bits(z) * n) >> 3));
+    zvec_block_decode_for(out, comp, n, z, (T)0);
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        ops->decode_dict(out, t, n);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        ops->decode_dict(out, t, n);
+    }
+}
+
+template <typename T>
+zvec_aggr<T> zvec_block_reduce_raw(T * __restrict x, size_t n)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        return ops->reduce(x, n);
+    }
+    if constexpr (sizeof(T) == 4) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
+        return ops->reduce(x, n);
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->reduce(x, n);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->reduce(x, n);
+    }
+}
+
+template <typename T>
+size_t zvec_block_count_raw(T * __restrict x, size_t n, T lo, T hi)
+{
+    if constexpr (sizeof(T) == 8) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
+        return ops->count(x, n, lo, hi);
     }
     if constexpr (sizeof(T) == 4) {
-        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
-        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
-        switch (z) {
-            case zvec_size_0: break;
-            case zvec_size_8: ops->encode_abs_x8(in, (x8*)comp, n); break;
-            case zvec_size_16: ops->encode_abs_x16(in, (x16*)comp, n); break;
-            case zvec_size_24: ops->encode_abs_x24(in, (x24*)comp, n); break;
-            default: abort(); break;
-        }
+        return ops->count(x, n, lo, hi);
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->count(x, n, lo, hi);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->count(x, n, lo, hi);
     }
 }
 
 template <typename T>
-void zvec_block_decode_abs(T * __restrict out, void * __restrict comp, size_t n, zvec_size z)
+size_t zvec_block_match_raw(T * __restrict x, size_t n, T lo, T hi, u64 * __restrict bits)
 {
     if constexpr (sizeof(T) == 8) {
-        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
-        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
-        typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
-        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
-        switch (z) {
-            case zvec_size_8: ops->decode_abs_x8(out, (x8*)comp, n); break;
-            case zvec_size_16: ops->decode_abs_x16(out, (x16*)comp, n); break;
-            case zvec_size_24: ops->decode_abs_x24(out, (x24*)comp, n); break;
-            case zvec_size_32: ops->decode_abs_x32(out, (x32*)comp, n); break;
-            case zvec_size_48: ops->decode_abs_x48(out, (x48*)comp, n); break;
-            default: abort(); break;
-        }
+        return ops->match(x, n, lo, hi, bits);
     }
     if constexpr (sizeof(T) == 4) {
-        typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
-        typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
-        switch (z) {
-            case zvec_size_8: ops->decode_abs_x8(out, (x8*)comp, n); break;
-            case zvec_size_16: ops->decode_abs_x16(out, (x16*)comp, n); break;
-            case zvec_size_24: ops->decode_abs_x24(out, (x24*)comp, n); break;
-            default: abort(); break;
-        }
+        return ops->match(x, n, lo, hi, bits);
+    }
+    if constexpr (sizeof(T) == 2) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i16,zvec_op_types_u16>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i16() : (zvec_ops*)get_zvec_ops_u16();
+        return ops->match(x, n, lo, hi, bits);
+    }
+    if constexpr (sizeof(T) == 1) {
+        typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i8,zvec_op_types_u8>::type zvec_ops;
+        zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i8() : (zvec_ops*)get_zvec_ops_u8();
+        return ops->match(x, n, lo, hi, bits);
     }
 }
 
+/* narrow reductions exist for 8, 16 and 32-bit absolute blocks */
 template <typename T>
-void zvec_block_encode_rel(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv)
+void zvec_block_encode_lin(T * __restrict in, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    int b = zvec_size_bits(z);
+    if (b != 8 && b != 16) memset(comp, 0, (b * n) >> 3);
+    for (size_t i = 0; i < n; i++) {
+        U o = (U)in[i] - (U)iv - (U)(i + 1) * (U)dv;
+        if (b == 8) ((u8*)comp)[i] = (u8)o;
+        else if (b == 16) ((u16*)comp)[i] = (u16)o;
+        else zvec_bits_put<U>(comp, b, i, o);
+    }
+}
+
+template <typename T>
+void zvec_block_decode_lin(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv, T dv)
+{
+    zvec_block_decode_for(out, comp, n, z, (T)0);
+    zvec_block_synth_add(out, n, iv, dv);
+}
+
+template <typename T>
+T zvec_block_access_lin(void * __restrict comp, zvec_size z, T iv, T dv, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    int b = zvec_size_bits(z);
+    U o = b == 8 ? ((u8*)comp)[i] : b == 16 ? ((u16*)comp)[i] : zvec_bits_get<U>(comp, b, i);
+    return (T)((U)iv + (U)(i + 1) * (U)dv + o);
+}
+
+/*
+ * sums of dictionary blocks use a histogram of the indices and counts map
+ * the range to an index range in the sorted table, so values are not
+ * gathered. the table holds the minimum and maximum.
+ */
+
+template <typename T>
+zvec_aggr<T> zvec_block_reduce_dict(T * __restrict tmp, void * __restrict comp, size_t n, T dv)
+{
+    using U = typename std::make_unsigned<T>::type;
+    size_t count = (U)dv, hist[zvec_dict_limit] = { 0 };
+    zvec_size z = zvec_size_index(count);
+    T *t = (T*)((char*)comp + ((zvec_size_bits(z) * n) >> 3));
+    zvec_block_decode_for(tmp, comp, n, z, (T)0);
+    for (size_t i = 0; i < n; i++) hist[(U)tmp[i]]++;
+    U sum = 0;
+    for (size_t k = 0; k < count; k++) sum += (U)t[k] * (U)hist[k];
+    return zvec_aggr<T>{ (T)sum, t[0], t[count - 1] };
+}
+
+template <typename T>
+size_t zvec_block_count_dict(T * __restrict tmp, void * __restrict comp, size_t n, T dv, T lo, T hi)
+{
+    using U = typename std::make_unsigned<T>::type;
+    size_t count = (U)dv;
+    zvec_size z = zvec_size_index(count);
+    T *t = (T*)((char*)comp + ((zvec_size_bits(z) * n) >> 3));
+    size_t a = std::lower_bound(t, t + count, lo) - t;
+    size_t e = std::upper_bound(t, t + count, hi) - t;
+    if (a >= e) return 0;
+    if (a == 0 && e == count) return n;
+    zvec_block_decode_for(tmp, comp, n, z, (T)0);
+    return zvec_block_count_raw(tmp, n, (T)a, (T)(e - 1));
+}
+
+template <typename T>
+T zvec_block_access_dict(void * __restrict comp, size_t n, T dv, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    int b = zvec_size_bits(zvec_size_index((U)dv));
+    T *t = (T*)((char*)comp + ((b * n) >> 3));
+    return t[b == 8 ? ((u8*)comp)[i] : zvec_bits_get<U>(comp, b, i)];
+}
+
+template <typename T>
+constexpr bool zvec_block_has_narrow(zvec_size z)
+{
+    return z == zvec_size_8 || z == zvec_size_16 ||
+        (z == zvec_size_32 && sizeof(T) == 8);
+}
+
+template <typename T>
+zvec_aggr<T> zvec_block_reduce_abs(void * __restrict comp, size_t n, zvec_size z)
 {
     if constexpr (sizeof(T) == 8) {
         typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
         typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
-        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
         switch (z) {
-            case zvec_size_8: ops->encode_rel_x8(in, (x8*)comp, n, iv); break;
-            case zvec_size_16: ops->encode_rel_x16(in, (x16*)comp, n, iv); break;
-            case zvec_size_24: ops->encode_rel_x24(in, (x24*)comp, n, iv); break;
-            case zvec_size_32: ops->encode_rel_x32(in, (x32*)comp, n, iv); break;
-            case zvec_size_48: ops->encode_rel_x48(in, (x48*)comp, n, iv); break;
+            case zvec_size_8: return ops->reduce_abs_x8((x8*)comp, n);
+            case zvec_size_16: return ops->reduce_abs_x16((x16*)comp, n);
+            case zvec_size_32: return ops->reduce_abs_x32((x32*)comp, n);
             default: abort(); break;
         }
     }
     if constexpr (sizeof(T) == 4) {
         typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
         typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         switch (z) {
-            case zvec_size_8: ops->encode_rel_x8(in, (x8*)comp, n, iv); break;
-            case zvec_size_16: ops->encode_rel_x16(in, (x16*)comp, n, iv); break;
-            case zvec_size_24: ops->encode_rel_x24(in, (x24*)comp, n, iv); break;
+            case zvec_size_8: return ops->reduce_abs_x8((x8*)comp, n);
+            case zvec_size_16: return ops->reduce_abs_x16((x16*)comp, n);
             default: abort(); break;
         }
     }
 }
 
+/* clamp the bounds to the narrow type, skipping blocks outside its range */
+template <typename T, typename S, typename F>
+size_t zvec_block_count_narrow(F fn, S * __restrict comp, size_t n, T lo, T hi)
+{
+    T smin = (T)std::numeric_limits<S>::min();
+    T smax = (T)std::numeric_limits<S>::max();
+    if (hi < smin || lo > smax) return 0;
+    return fn(comp, n, (S)std::max(lo, smin), (S)std::min(hi, smax));
+}
+
 template <typename T>
-void zvec_block_decode_rel(T * __restrict out, void * __restrict comp, size_t n, zvec_size z, T iv)
+size_t zvec_block_count_abs(void * __restrict comp, size_t n, zvec_size z, T lo, T hi)
 {
     if constexpr (sizeof(T) == 8) {
         typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
         typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
-        typedef typename std::conditional<std::is_signed<T>::value,i48,u48>::type x48;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i64,zvec_op_types_u64>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i64() : (zvec_ops*)get_zvec_ops_u64();
         switch (z) {
-            case zvec_size_8: ops->decode_rel_x8(out, (x8*)comp, n, iv); break;
-            case zvec_size_16: ops->decode_rel_x16(out, (x16*)comp, n, iv); break;
-            case zvec_size_24: ops->decode_rel_x24(out, (x24*)comp, n, iv); break;
-            case zvec_size_32: ops->decode_rel_x32(out, (x32*)comp, n, iv); break;
-            case zvec_size_48: ops->decode_rel_x48(out, (x48*)comp, n, iv); break;
+            case zvec_size_8: return zvec_block_count_narrow(ops->count_abs_x8, (x8*)comp, n, lo, hi);
+            case zvec_size_16: return zvec_block_count_narrow(ops->count_abs_x16, (x16*)comp, n, lo, hi);
+            case zvec_size_32: return zvec_block_count_narrow(ops->count_abs_x32, (x32*)comp, n, lo, hi);
             default: abort(); break;
         }
     }
     if constexpr (sizeof(T) == 4) {
         typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
         typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
-        typedef typename std::conditional<std::is_signed<T>::value,i24,u24>::type x24;
         typedef typename std::conditional<std::is_signed<T>::value,zvec_op_types_i32,zvec_op_types_u32>::type zvec_ops;
         zvec_ops *ops = (std::is_signed<T>::value) ? (zvec_ops*)get_zvec_ops_i32() : (zvec_ops*)get_zvec_ops_u32();
         switch (z) {
-            case zvec_size_8: ops->decode_rel_x8(out, (x8*)comp, n, iv); break;
-            case zvec_size_16: ops->decode_rel_x16(out, (x16*)comp, n, iv); break;
-            case zvec_size_24: ops->decode_rel_x24(out, (x24*)comp, n, iv); break;
+            case zvec_size_8: return zvec_block_count_narrow(ops->count_abs_x8, (x8*)comp, n, lo, hi);
+            case zvec_size_16: return zvec_block_count_narrow(ops->count_abs_x16, (x16*)comp, n, lo, hi);
             default: abort(); break;
         }
     }
@@ -356,8 +2000,12 @@ void zvec_block_decode_rel(T * __restrict out, void * __restrict comp, size_t n,
  * - select block codec and size from statistics
  *   zvec_format zvec_block_format(zvec_stats<T> s);
  *
+ * - select block codec and size from statistics including elias-fano
+ *   zvec_format zvec_block_format(zvec_stats<T> s, size_t n);
+ *
  * - gather block iv and delta from statistics
  *   zvec_meta<T> zvec_block_metadata(zvec_stats<T> s);
+ *   zvec_meta<T> zvec_block_metadata(zvec_stats<T> s, size_t n);
  *
  * - block size from format
  *   size_t zvec_block_size(zvec_format fmt, size_t n);
@@ -370,12 +2018,24 @@ void zvec_block_decode_rel(T * __restrict out, void * __restrict comp, size_t n,
  *
  * - decode block using metadata
  *   void zvec_block_decode(T * out, void * comp, size_t n, zvec_format fmt, zvec_meta<T> meta);
+ *
+ * - reduce block to sum, min and max using scratch for decoding if needed
+ *   zvec_aggr<T> zvec_block_reduce(T * tmp, void * comp, size_t n, zvec_format fmt, zvec_meta<T> meta);
+ *
+ * - count block elements in [lo, hi] using scratch for decoding if needed
+ *   size_t zvec_block_count(T * tmp, void * comp, size_t n, zvec_format fmt, zvec_meta<T> meta, T lo, T hi);
+ *
+ * - read element i without decoding if zvec_block_has_access(fmt)
+ *   T zvec_block_access(void * comp, size_t n, zvec_format fmt, zvec_meta<T> meta, size_t i);
+ *
+ * - read element 0 without decoding if zvec_block_has_first(fmt)
+ *   T zvec_block_first(void * comp, size_t n, zvec_format fmt, zvec_meta<T> meta);
  */
 
 struct zvec_format
 {
-    u8 codec : 3;
-    u8 size : 4;
+    u8 codec;
+    u8 size;
 };
 
 template <typename T>
@@ -394,7 +2054,7 @@ zvec_stats<T> zvec_block_scan(T * __restrict in, size_t n, zvec_codec codec)
     case zvec_block_abs: return zvec_block_scan_abs(in, n);
     case zvec_block_rel: return zvec_block_scan_rel(in, n);
     case zvec_block_rel_or_abs: return zvec_block_scan_both(in, n);
-    default: return zvec_stats<T> { zvec_codec_none };
+    default: return zvec_stats<T> {};
     }    
 }
 
@@ -410,7 +2070,12 @@ constexpr zvec_format zvec_block_format(zvec_stats<T> s)
             return zvec_format { (u8)zvec_const_abs, 0 };
         } else {
             zvec_size size_abs = zvec_size_abs(s);
-            return zvec_format { (u8)zvec_block_abs, (u8)size_abs };
+            zvec_size size_for = zvec_size_for(s);
+            if (size_for < size_abs) {
+                return zvec_format { (u8)zvec_block_for, (u8)size_for };
+            } else {
+                return zvec_format { (u8)zvec_block_abs, (u8)size_abs };
+            }
         }
     case zvec_block_rel:
         if (s.dmin == s.dmax) {
@@ -419,6 +2084,9 @@ constexpr zvec_format zvec_block_format(zvec_stats<T> s)
             } else {
                 return zvec_format { (u8)zvec_const_rel, 0 };
             }
+        } else if (s.dmin >= 0) {
+            zvec_size size_mono = zvec_size_mono(s);
+            return zvec_format { (u8)zvec_block_mono, (u8)size_mono };
         } else {
             zvec_size size_rel = zvec_size_rel(s);
             return zvec_format { (u8)zvec_block_rel, (u8)size_rel };
@@ -430,11 +2098,27 @@ constexpr zvec_format zvec_block_format(zvec_stats<T> s)
             } else {
                 return zvec_format { (u8)zvec_const_rel, 0 };
             }
+        } else if (s.dmin >= 0) {
+            /* prefer mono on ties so sorted pages keep their first value in iv */
+            zvec_size size_abs = zvec_size_abs(s);
+            zvec_size size_for = zvec_size_for(s);
+            zvec_size size_mono = zvec_size_mono(s);
+            if (size_abs < size_mono && size_abs <= size_for) {
+                return zvec_format { (u8)zvec_block_abs, (u8)size_abs };
+            } else if (size_for < size_mono) {
+                return zvec_format { (u8)zvec_block_for, (u8)size_for };
+            } else {
+                return zvec_format { (u8)zvec_block_mono, (u8)size_mono };
+            }
         } else {
+            /* frame of reference must be smaller than deltas or absolute values */
             zvec_size size_abs = zvec_size_abs(s);
+            zvec_size size_for = zvec_size_for(s);
             zvec_size size_rel = zvec_size_rel(s);
-            if (size_abs <= size_rel) {
+            if (size_abs <= size_rel && size_abs <= size_for) {
                 return zvec_format { (u8)zvec_block_abs, (u8)size_abs };
+            } else if (size_for < size_rel) {
+                return zvec_format { (u8)zvec_block_for, (u8)size_for };
             } else {
                 return zvec_format { (u8)zvec_block_rel, (u8)size_rel };
             }
@@ -445,6 +2129,40 @@ constexpr zvec_format zvec_block_format(zvec_stats<T> s)
     return zvec_format { (u8)zvec_codec_none, 0 };
 }
 
+/*
+ * select block codec and size from statistics including the codecs that
+ * depend on the block length. the candidates only replace the simple codecs
+ * and one is chosen only when it is smaller, so ties keep the earlier one.
+ */
+
+template <typename T>
+zvec_format zvec_block_format(zvec_stats<T> s, size_t n)
+{
+    zvec_format fmt = zvec_block_format(s);
+    if (fmt.codec != zvec_block_abs && fmt.codec != zvec_block_for &&
+        fmt.codec != zvec_block_rel && fmt.codec != zvec_block_mono) {
+        return fmt;
+    }
+    const zvec_format candidates[] = {
+        { (u8)zvec_block_ef, (u8)zvec_size_ef(s, n) },
+        { (u8)zvec_block_lin, s.lsize },
+        { (u8)zvec_block_dod, s.size2 },
+        { (u8)zvec_block_gcd, s.gsize },
+        { (u8)zvec_block_pfor, s.pclass },
+        { (u8)zvec_block_rle, (u8)zvec_size_rle(s, n) },
+        { (u8)zvec_block_dict, (u8)zvec_size_dict(s, n) },
+        { (u8)zvec_block_mini, s.msize },
+        { (u8)zvec_block_svb, s.vsize },
+    };
+    for (zvec_format c : candidates) {
+        if (c.size != zvec_size_0 && zvec_size_bits((zvec_size)c.size) <
+            zvec_size_bits((zvec_size)fmt.size)) {
+            fmt = c;
+        }
+    }
+    return fmt;
+}
+
 /* gather block iv and delta from statistics */
 
 template <typename T>
@@ -460,6 +2178,14 @@ zvec_meta<T> zvec_block_metadata(zvec_stats<T> s)
         assert(s.codec == zvec_block_rel || s.codec == zvec_block_rel_or_abs);
         assert(s.dmin != s.dmax);
         return zvec_meta<T> { s.iv, 0 };
+    case zvec_block_mono:
+        assert(s.codec == zvec_block_rel || s.codec == zvec_block_rel_or_abs);
+        assert(s.dmin != s.dmax && s.dmin >= 0);
+        return zvec_meta<T> { s.iv, 0 };
+    case zvec_block_for:
+        assert(s.codec == zvec_block_abs || s.codec == zvec_block_rel_or_abs);
+        assert(s.amin != s.amax);
+        return zvec_meta<T> { s.amin, 0 };
     case zvec_const_abs:
         assert(s.codec == zvec_block_abs || s.codec == zvec_block_rel_or_abs);
         assert(s.amin == s.amax);
@@ -474,6 +2200,42 @@ zvec_meta<T> zvec_block_metadata(zvec_stats<T> s)
     return zvec_meta<T> { 0, 0 };
 }
 
+template <typename T>
+zvec_meta<T> zvec_block_metadata(zvec_stats<T> s, size_t n)
+{
+    zvec_format fmt = zvec_block_format(s, n);
+    if (fmt.codec == zvec_block_ef) {
+        assert(s.dmin >= 0 && s.amin == s.iv);
+        return zvec_meta<T> { s.iv, 0 };
+    }
+    if (fmt.codec == zvec_block_pfor) {
+        using U = typename std::make_unsigned<T>::type;
+        return zvec_meta<T> { s.amin, (T)((U)s.psize | (U)s.pcount << 8) };
+    }
+    if (fmt.codec == zvec_block_rle) {
+        return zvec_meta<T> { s.iv, (T)s.runs };
+    }
+    if (fmt.codec == zvec_block_dict) {
+        return zvec_meta<T> { s.iv, (T)s.dcount };
+    }
+    if (fmt.codec == zvec_block_lin) {
+        return zvec_meta<T> { s.liv, s.ldv };
+    }
+    if (fmt.codec == zvec_block_dod) {
+        return zvec_meta<T> { s.iv2, s.dv2 };
+    }
+    if (fmt.codec == zvec_block_gcd) {
+        return zvec_meta<T> { s.amin, s.gdiv };
+    }
+    if (fmt.codec == zvec_block_mini) {
+        return zvec_meta<T> { 0, 0 };
+    }
+    if (fmt.codec == zvec_block_svb) {
+        return zvec_meta<T> { s.amin, 0 };
+    }
+    return zvec_block_metadata(s);
+}
+
 /* block size from format */
 
 template <typename T>
@@ -482,6 +2244,20 @@ size_t zvec_block_size(zvec_format fmt, size_t n)
     switch (fmt.codec) {
     case zvec_block_abs:
     case zvec_block_rel:
+    case zvec_block_mono:
+    case zvec_block_ef:
+    case zvec_block_for:
+    case zvec_block_pfor:
+    case zvec_block_rle:
+    case zvec_block_dict:
+    case zvec_block_lin:
+    case zvec_block_dod:
+    case zvec_block_gcd:
+    case zvec_block_xor:
+    case zvec_block_decimal:
+    case zvec_block_mini:
+    case zvec_block_svb:
+    case zvec_block_ref:
         return (zvec_size_bits((zvec_size)fmt.size) * n) >> 3;
     case zvec_const_abs:
     case zvec_const_rel:
@@ -500,6 +2276,20 @@ size_t zvec_block_align(zvec_format fmt, size_t n)
     switch (fmt.codec) {
     case zvec_block_abs:
     case zvec_block_rel:
+    case zvec_block_mono:
+    case zvec_block_ef:
+    case zvec_block_for:
+    case zvec_block_pfor:
+    case zvec_block_rle:
+    case zvec_block_dict:
+    case zvec_block_lin:
+    case zvec_block_dod:
+    case zvec_block_gcd:
+    case zvec_block_xor:
+    case zvec_block_decimal:
+    case zvec_block_mini:
+    case zvec_block_svb:
+    case zvec_block_ref:
         return 64;
     case zvec_const_abs:
     case zvec_const_rel:
@@ -520,8 +2310,39 @@ void zvec_block_encode(T * __restrict in, void * __restrict comp, size_t n, zvec
         zvec_block_encode_abs(in, comp, n, (zvec_size)fmt.size);
         break;
     case zvec_block_rel:
+    case zvec_block_mono:
         zvec_block_encode_rel(in, comp, n, (zvec_size)fmt.size, meta.iv);
         break;
+    case zvec_block_ef:
+        zvec_block_encode_ef(in, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_block_for:
+        zvec_block_encode_for(in, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_block_pfor:
+        zvec_block_encode_pfor(in, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_rle:
+        zvec_block_encode_rle(in, comp, n, meta.dv);
+        break;
+    case zvec_block_dict:
+        zvec_block_encode_dict(in, comp, n, meta.dv);
+        break;
+    case zvec_block_lin:
+        zvec_block_encode_lin(in, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_dod:
+        zvec_block_encode_dod(in, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_gcd:
+        zvec_block_encode_gcd(in, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_mini:
+        zvec_block_encode_mini(in, comp, n, (zvec_size)fmt.size);
+        break;
+    case zvec_block_svb:
+        zvec_block_encode_svb(in, comp, n, meta.iv);
+        break;
     case zvec_const_abs:
         break;
     case zvec_const_rel:
@@ -542,6 +2363,39 @@ void zvec_block_decode(T * __restrict out, void * __restrict comp, size_t n, zve
     case zvec_block_rel:
         zvec_block_decode_rel(out, comp, n, (zvec_size)fmt.size, meta.iv);
         break;
+    case zvec_block_mono:
+        zvec_block_decode_mono(out, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_block_ef:
+        zvec_block_decode_ef(out, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_block_for:
+        zvec_block_decode_for(out, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_block_pfor:
+        zvec_block_decode_pfor(out, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_rle:
+        zvec_block_decode_rle(out, comp, n, meta.dv);
+        break;
+    case zvec_block_dict:
+        zvec_block_decode_dict(out, comp, n, meta.dv);
+        break;
+    case zvec_block_lin:
+        zvec_block_decode_lin(out, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_dod:
+        zvec_block_decode_dod(out, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_gcd:
+        zvec_block_decode_gcd(out, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        break;
+    case zvec_block_mini:
+        zvec_block_decode_mini(out, comp, n, (zvec_size)fmt.size);
+        break;
+    case zvec_block_svb:
+        zvec_block_decode_svb(out, comp, n, meta.iv);
+        break;
     case zvec_const_abs:
         zvec_block_synth_abs(out, n, meta.iv);
         break;
@@ -550,3 +2404,311 @@ void zvec_block_decode(T * __restrict out, void * __restrict comp, size_t n, zve
         break;
     }
 }
+
+/*
+ * constant delta blocks are monotone unless the series wraps. the values
+ * are iv + (i + 1) * dv for i in [0, n) with the sign of dv as direction.
+ */
+
+template <typename T>
+bool zvec_series_monotone(T iv, T dv, size_t n)
+{
+    using U = typename std::make_unsigned<T>::type;
+    using TS = typename std::make_signed<T>::type;
+    U x0 = (U)iv + (U)dv;
+    U ad = (TS)dv < 0 ? (U)0 - (U)dv : (U)dv;
+    U room = (TS)dv < 0 ? x0 - (U)std::numeric_limits<T>::min()
+                        : (U)std::numeric_limits<T>::max() - x0;
+    return n < 2 || ad == 0 || room / ad >= n - 1;
+}
+
+template <typename T>
+T zvec_series_value(T iv, T dv, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    return (T)((U)iv + (U)(i + 1) * (U)dv);
+}
+
+/* reduce block using metadata */
+
+template <typename T>
+zvec_aggr<T> zvec_block_reduce(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta)
+{
+    using U = typename std::make_unsigned<T>::type;
+    using TS = typename std::make_signed<T>::type;
+    switch (fmt.codec) {
+    case zvec_block_abs:
+        if (zvec_block_has_narrow<T>((zvec_size)fmt.size)) {
+            return zvec_block_reduce_abs<T>(comp, n, (zvec_size)fmt.size);
+        }
+        zvec_block_decode_abs(tmp, comp, n, (zvec_size)fmt.size);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_rel:
+        zvec_block_decode_rel(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_mono:
+        zvec_block_decode_mono(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_ef:
+        zvec_block_decode_ef(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_for:
+        zvec_block_decode_for(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_pfor:
+        zvec_block_decode_pfor(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_rle:
+        return zvec_block_reduce_rle(comp, meta.dv);
+    case zvec_block_dict:
+        return zvec_block_reduce_dict(tmp, comp, n, meta.dv);
+    case zvec_block_lin:
+        zvec_block_decode_lin(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_dod:
+        zvec_block_decode_dod(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_gcd:
+        zvec_block_decode_gcd(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_mini:
+        zvec_block_decode_mini(tmp, comp, n, (zvec_size)fmt.size);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_block_svb:
+        zvec_block_decode_svb(tmp, comp, n, meta.iv);
+        return zvec_block_reduce_raw(tmp, n);
+    case zvec_const_abs:
+        return zvec_aggr<T>{ (T)((U)n * (U)meta.iv), meta.iv, meta.iv };
+    case zvec_const_rel:
+        if (zvec_series_monotone(meta.iv, meta.dv, n)) {
+            /* n * iv + dv * n(n+1)/2 in modular arithmetic */
+            U tri = (n & 1) ? (U)n * (U)((n + 1) >> 1) : (U)(n >> 1) * (U)(n + 1);
+            T sum = (T)((U)n * (U)meta.iv + tri * (U)meta.dv);
+            T first = zvec_series_value(meta.iv, meta.dv, 0);
+            T last = zvec_series_value(meta.iv, meta.dv, n - 1);
+            return (TS)meta.dv < 0 ? zvec_aggr<T>{ sum, last, first }
+                                   : zvec_aggr<T>{ sum, first, last };
+        }
+        zvec_block_synth_rel(tmp, n, meta.iv, meta.dv);
+        return zvec_block_reduce_raw(tmp, n);
+    }
+    return zvec_aggr<T>{ 0, 0, 0 };
+}
+
+/* count block elements in [lo, hi] using metadata */
+
+template <typename T>
+size_t zvec_block_count(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta, T lo, T hi)
+{
+    using TS = typename std::make_signed<T>::type;
+    switch (fmt.codec) {
+    case zvec_block_abs:
+        if (zvec_block_has_narrow<T>((zvec_size)fmt.size)) {
+            return zvec_block_count_abs<T>(comp, n, (zvec_size)fmt.size, lo, hi);
+        }
+        zvec_block_decode_abs(tmp, comp, n, (zvec_size)fmt.size);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_rel:
+        zvec_block_decode_rel(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_mono:
+        zvec_block_decode_mono(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_ef:
+        zvec_block_decode_ef(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_for:
+        zvec_block_decode_for(tmp, comp, n, (zvec_size)fmt.size, meta.iv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_pfor:
+        zvec_block_decode_pfor(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_rle:
+        return zvec_block_count_rle(comp, meta.dv, lo, hi);
+    case zvec_block_dict:
+        return zvec_block_count_dict(tmp, comp, n, meta.dv, lo, hi);
+    case zvec_block_lin:
+        zvec_block_decode_lin(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_dod:
+        zvec_block_decode_dod(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_gcd:
+        zvec_block_decode_gcd(tmp, comp, n, (zvec_size)fmt.size, meta.iv, meta.dv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_mini:
+        zvec_block_decode_mini(tmp, comp, n, (zvec_size)fmt.size);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_block_svb:
+        zvec_block_decode_svb(tmp, comp, n, meta.iv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    case zvec_const_abs:
+        return meta.iv >= lo && meta.iv <= hi ? n : 0;
+    case zvec_const_rel:
+        if (zvec_series_monotone(meta.iv, meta.dv, n)) {
+            /* partition points of the monotone series by binary search */
+            bool up = (TS)meta.dv >= 0;
+            auto part = [&](auto pred) {
+                size_t l = 0, h = n;
+                while (l < h) {
+                    size_t m = (l + h) >> 1;
+                    if (pred(zvec_series_value(meta.iv, meta.dv, m))) l = m + 1;
+                    else h = m;
+                }
+                return l;
+            };
+            size_t a = up ? part([&](T v) { return v < lo; })
+                          : part([&](T v) { return v > hi; });
+            size_t b = up ? part([&](T v) { return v <= hi; })
+                          : part([&](T v) { return v >= lo; });
+            return b - a;
+        }
+        zvec_block_synth_rel(tmp, n, meta.iv, meta.dv);
+        return zvec_block_count_raw(tmp, n, lo, hi);
+    }
+    return 0;
+}
+
+/*
+ * elias-fano, run-length, dictionary, linear, narrow absolute, frame of
+ * reference, common divisor, mini, stream vbyte and constant blocks can
+ * read one element without decoding the block. other formats need to be
+ * decoded.
+ */
+
+template <typename T>
+bool zvec_block_has_access(zvec_format fmt)
+{
+    switch (fmt.codec) {
+    case zvec_block_abs: return zvec_block_has_narrow<T>((zvec_size)fmt.size);
+    case zvec_block_for: return zvec_block_has_narrow<T>((zvec_size)fmt.size);
+    case zvec_block_gcd: return zvec_block_has_narrow<T>((zvec_size)fmt.size);
+    case zvec_block_ef: return true;
+    case zvec_block_rle: return true;
+    case zvec_block_dict: return true;
+    case zvec_block_lin: return true;
+    case zvec_block_mini: return true;
+    case zvec_block_svb: return true;
+    case zvec_const_abs: return true;
+    case zvec_const_rel: return true;
+    default: return false;
+    }
+}
+
+/* read element i of a block using metadata */
+
+template <typename T>
+T zvec_block_access(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+    typedef typename std::conditional<std::is_signed<T>::value,i16,u16>::type x16;
+    typedef typename std::conditional<std::is_signed<T>::value,i32,u32>::type x32;
+    switch (fmt.codec) {
+    case zvec_block_abs:
+        switch ((zvec_size)fmt.size) {
+        case zvec_size_8: return (T)((x8*)comp)[i];
+        case zvec_size_16: return (T)((x16*)comp)[i];
+        case zvec_size_32: return (T)((x32*)comp)[i];
+        default: abort();
+        }
+    case zvec_block_for:
+        switch ((zvec_size)fmt.size) {
+        case zvec_size_8: return (T)((U)meta.iv + ((u8*)comp)[i]);
+        case zvec_size_16: return (T)((U)meta.iv + ((u16*)comp)[i]);
+        case zvec_size_32: return (T)((U)meta.iv + ((u32*)comp)[i]);
+        default: abort();
+        }
+    case zvec_block_gcd:
+        switch ((zvec_size)fmt.size) {
+        case zvec_size_8: return (T)((U)meta.iv + (U)meta.dv * ((u8*)comp)[i]);
+        case zvec_size_16: return (T)((U)meta.iv + (U)meta.dv * ((u16*)comp)[i]);
+        case zvec_size_32: return (T)((U)meta.iv + (U)meta.dv * ((u32*)comp)[i]);
+        default: abort();
+        }
+    case zvec_block_ef:
+        return zvec_block_select_ef(comp, n, (zvec_size)fmt.size, meta.iv, i);
+    case zvec_block_rle:
+        return zvec_block_access_rle(comp, meta.dv, i);
+    case zvec_block_dict:
+        return zvec_block_access_dict(comp, n, meta.dv, i);
+    case zvec_block_lin:
+        return zvec_block_access_lin(comp, (zvec_size)fmt.size, meta.iv, meta.dv, i);
+    case zvec_block_mini:
+        return zvec_block_access_mini<T>(comp, n, (zvec_size)fmt.size, i);
+    case zvec_block_svb:
+        return zvec_block_access_svb(comp, n, meta.iv, i);
+    case zvec_const_abs:
+        return meta.iv;
+    case zvec_const_rel:
+        return zvec_series_value(meta.iv, meta.dv, i);
+    default:
+        abort();
+    }
+    return 0;
+}
+
+/*
+ * first element of a block. bit-packed and byte-wide fields both hold
+ * element 0 in the low bits of the first word and patched frame of
+ * reference positions are ascending, so absolute, frame of reference,
+ * common divisor and patched blocks read it without decoding the block.
+ */
+
+template <typename T>
+bool zvec_block_has_first(zvec_format fmt)
+{
+    switch (fmt.codec) {
+    case zvec_block_abs: return true;
+    case zvec_block_for: return true;
+    case zvec_block_gcd: return true;
+    case zvec_block_pfor: return true;
+    default: return zvec_block_has_access<T>(fmt);
+    }
+}
+
+template <typename T>
+typename std::make_unsigned<T>::type zvec_block_field0(void * __restrict comp, zvec_size z)
+{
+    using U = typename std::make_unsigned<T>::type;
+    constexpr int W = sizeof(U) * 8;
+    int b = zvec_size_bits(z);
+    U v;
+    if (b == 0) return 0;
+    memcpy(&v, comp, sizeof(U));
+    return b >= W ? v : (U)(v & (((U)1 << b) - 1));
+}
+
+template <typename T>
+T zvec_block_first(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta)
+{
+    using U = typename std::make_unsigned<T>::type;
+    constexpr int W = sizeof(U) * 8;
+    zvec_size z = (zvec_size)fmt.size;
+    switch (fmt.codec) {
+    case zvec_block_abs: {
+        U v = zvec_block_field0<T>(comp, z);
+        int b = zvec_size_bits(z);
+        if (std::is_signed<T>::value && b < W) {
+            v = (U)((T)(v << (W - b)) >> (W - b));
+        }
+        return (T)v;
+    }
+    case zvec_block_for:
+        return (T)((U)meta.iv + zvec_block_field0<T>(comp, z));
+    case zvec_block_gcd:
+        return (T)((U)meta.iv + (U)meta.dv * zvec_block_field0<T>(comp, z));
+    case zvec_block_pfor: {
+        zvec_size p = (zvec_size)((U)meta.dv & 0xff);
+        size_t count = (size_t)((U)meta.dv >> 8);
+        int b = zvec_size_bits(p);
+        T *patch = (T*)((char*)comp + ((b * n) >> 3));
+        u16 *pos = (u16*)(patch + count);
+        U v = (U)meta.iv + zvec_block_field0<T>(comp, p);
+        if (count > 0 && pos[0] == 0) v += (U)patch[0] << b;
+        return (T)v;
+    }
+    default:
+        return zvec_block_access(comp, n, fmt, meta, 0);
+    }
+}
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <cstdint>
 
 #include <tuple>
@@ -28,6 +29,8 @@
 
 #include <hwy/highway.h>
 
+#include "zvec_bits.h"
+
 #if defined(ZVECTOR_ARCH_X86_AVX3)
 #define ZVECTOR_ARCH x86_avx3
 #else
@@ -76,6 +79,9 @@ typedef uint16_t u16;
 typedef uint32_t u32;
 typedef uint64_t u64;
 
+typedef float f32;
+typedef double f64;
+
 struct si24 { i8 raw[3]; };
 struct si48 { i16 raw[3]; };
 struct ui24 { u8 raw[3]; };
@@ -156,10 +162,48 @@ enum zvec_codec
     zvec_block_rel = 1,
     zvec_block_abs = 2,
     zvec_block_rel_or_abs = 3,
+    zvec_block_mono = 4,
     zvec_const_rel = 5,
     zvec_const_abs = 6,
+    zvec_block_ef = 7,
+    zvec_block_for = 8,
+    zvec_block_pfor = 9,
+    zvec_block_rle = 10,
+    zvec_block_dict = 11,
+    zvec_block_lin = 12,
+    zvec_block_dod = 13,
+    zvec_block_gcd = 14,
+    zvec_block_xor = 15,
+    zvec_block_decimal = 16,
+    zvec_block_mini = 17,
+    zvec_block_svb = 18,
+    zvec_block_ref = 19,
 };
 
+/*
+ * relative and monotone blocks hold deltas that are summed on decode.
+ * relative deltas and absolute values of signed types are sign-extended,
+ * monotone deltas are unsigned and zero-extended which doubles the range
+ * of each width for non-decreasing sequences. frame of reference blocks
+ * hold unsigned offsets from a base that is added on decode.
+ */
+constexpr bool zvec_codec_delta(zvec_codec codec)
+{
+    return codec == zvec_block_rel || codec == zvec_block_mono;
+}
+
+constexpr bool zvec_codec_base(zvec_codec codec)
+{
+    return codec == zvec_block_for;
+}
+
+template <typename T>
+constexpr bool zvec_codec_sext(zvec_codec codec)
+{
+    return codec == zvec_block_rel ||
+        (codec == zvec_block_abs && std::is_signed<T>::value);
+}
+
 template <typename T>
 struct zvec_stats
 {
@@ -170,8 +214,99 @@ struct zvec_stats
     TS dmax;
     T amin;
     T amax;
+    u32 runs;
+    u8 psize;
+    u8 pclass;
+    u16 pcount;
+    u16 dcount;
+    u8 lsize;
+    T liv;
+    T ldv;
+    u8 size2;
+    T iv2;
+    T dv2;
+    u8 gsize;
+    T gdiv;
+    u8 msize;
+    u8 vsize;
+};
+
+template <typename T>
+struct zvec_aggr
+{
+    T sum;
+    T min;
+    T max;
 };
 
+/*
+ * identity values for min and max, which are infinities for floating point
+ * types. integer sums wrap so are accumulated unsigned, floating point sums
+ * are accumulated in the element type.
+ */
+template <typename T>
+constexpr T zvec_lowest()
+{
+    return std::numeric_limits<T>::has_infinity ?
+        -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+}
+
+template <typename T>
+constexpr T zvec_highest()
+{
+    return std::numeric_limits<T>::has_infinity ?
+        std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+
+template <typename T>
+using zvec_accum = typename std::conditional<std::is_floating_point<T>::value,
+    std::common_type<T>, std::make_unsigned<T>>::type::type;
+
+/*
+ * lane minimum, maximum and sum. 8-bit lanes are reduced through memory
+ * for min and max, and with octet sums truncated to the lane width.
+ */
+template <class D>
+TFromD<D> ZVEC_ARCH_FN2(zvec_ll_lanes,min)(D d, Vec<D> v)
+{
+    using T = TFromD<D>;
+    if constexpr (sizeof(T) == 1) {
+        const size_t L = Lanes(d);
+        alignas(64) T t[L];
+        Store(v, d, t);
+        return *std::min_element(t, t + L);
+    } else {
+        return GetLane(MinOfLanes(d, v));
+    }
+}
+
+template <class D>
+TFromD<D> ZVEC_ARCH_FN2(zvec_ll_lanes,max)(D d, Vec<D> v)
+{
+    using T = TFromD<D>;
+    if constexpr (sizeof(T) == 1) {
+        const size_t L = Lanes(d);
+        alignas(64) T t[L];
+        Store(v, d, t);
+        return *std::max_element(t, t + L);
+    } else {
+        return GetLane(MaxOfLanes(d, v));
+    }
+}
+
+template <class D>
+TFromD<D> ZVEC_ARCH_FN2(zvec_ll_lanes,sum)(D d, Vec<D> v)
+{
+    using T = TFromD<D>;
+    if constexpr (sizeof(T) == 1) {
+        const ScalableTag<u8> b;
+        const ScalableTag<u64> q;
+        return (T)GetLane(SumOfLanes(q, SumsOf8(BitCast(b, v))));
+    } else {
+        return GetLane(SumOfLanes(d, v));
+    }
+}
+
 template <typename T>
 zvec_stats<T> ZVEC_ARCH_FN1(zvec_ll_block_scan_abs)(T * __restrict x, size_t N)
 {
@@ -191,11 +326,12 @@ zvec_stats<T> ZVEC_ARCH_FN1(zvec_ll_block_scan_abs)(T * __restrict x, size_t N)
         vamax = Max(vamax, v1);
     }
 
-    T amin = GetLane(MinOfLanes(d, vamin));
-    T amax = GetLane(MaxOfLanes(d, vamax));
+    T amin = ZVEC_ARCH_FN2(zvec_ll_lanes,min)(d, vamin);
+    T amax = ZVEC_ARCH_FN2(zvec_ll_lanes,max)(d, vamax);
     T iv = amin == amax ? x[0] : 0;
 
-    return zvec_stats<T>{ zvec_block_abs, iv, 0, 0, amin, amax };
+    return zvec_stats<T>{ zvec_block_abs, iv, 0, 0, amin, amax,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 }
 
 template <typename T>
@@ -238,11 +374,12 @@ zvec_stats<T> ZVEC_ARCH_FN1(zvec_ll_block_scan_rel)(T * __restrict x, size_t N)
         vdmax = Max(vdmax, BitCast(ds, v3));
     }
 
-    TS dmin = GetLane(MinOfLanes(ds, vdmin));
-    TS dmax = GetLane(MaxOfLanes(ds, vdmax));
+    TS dmin = ZVEC_ARCH_FN2(zvec_ll_lanes,min)(ds, vdmin);
+    TS dmax = ZVEC_ARCH_FN2(zvec_ll_lanes,max)(ds, vdmax);
     T iv = dmin == dmax ? x[0] - (x[1] - x[0]) : x[0];
 
-    return zvec_stats<T>{ zvec_block_rel, iv, dmin, dmax, 0, 0 };
+    return zvec_stats<T>{ zvec_block_rel, iv, dmin, dmax, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 }
 
 template <typename T>
@@ -262,14 +399,16 @@ zvec_stats<T> ZVEC_ARCH_FN1(zvec_ll_block_scan_both)(T * __restrict x, size_t N)
     Vec<decltype(ds)> vdmax = Set(ds, hwy::LowestValue<TS>());
     Vec<decltype(ds)> vdmin = Set(ds, hwy::HighestValue<TS>());
 
-    size_t i = 0;
+    /* runs are counted from lanes that differ from the previous element */
+    size_t i = 0, runs = 0;
     if (i < N) {
         v1 = Load(d, x+i);
         vamin = Min(vamin, v1);
         vamax = Max(vamax, v1);
-        v2 = CombineShiftRightLanes<HWY_LANES(T)-1>(d, v1, v0);
+        v2 = CombineShiftRightLanes<HWY_LANES(T)-1>(d, v1, Set(d, x[0]));
         v3 = Sub(v1, v2);
         v0 = v1;
+        runs += 1 + CountTrue(d, Ne(v1, v2));
         // hoisted iteration 0 due to this exception where we duplicate
         // lane 1 into lane 0 because its zero delta makes it impossible
         // to detect constant delta sequences i.e. where min(𝛿) == max(𝛿).
@@ -285,17 +424,19 @@ zvec_stats<T> ZVEC_ARCH_FN1(zvec_ll_block_scan_both)(T * __restrict x, size_t N)
         v2 = CombineShiftRightLanes<HWY_LANES(T)-1>(d, v1, v0);
         v3 = Sub(v1, v2);
         v0 = v1;
+        runs += CountTrue(d, Ne(v1, v2));
         vdmin = Min(vdmin, BitCast(ds, v3));
         vdmax = Max(vdmax, BitCast(ds, v3));
     }
 
-    T amin = GetLane(MinOfLanes(d, vamin));
-    T amax = GetLane(MaxOfLanes(d, vamax));
-    TS dmin = GetLane(MinOfLanes(ds, vdmin));
-    TS dmax = GetLane(MaxOfLanes(ds, vdmax));
+    T amin = ZVEC_ARCH_FN2(zvec_ll_lanes,min)(d, vamin);
+    T amax = ZVEC_ARCH_FN2(zvec_ll_lanes,max)(d, vamax);
+    TS dmin = ZVEC_ARCH_FN2(zvec_ll_lanes,min)(ds, vdmin);
+    TS dmax = ZVEC_ARCH_FN2(zvec_ll_lanes,max)(ds, vdmax);
     T iv = dmin == dmax ? x[0] - (x[1] - x[0]) : x[0];
 
-    return zvec_stats<T>{ zvec_block_rel_or_abs, iv, dmin, dmax, amin, amax };
+    return zvec_stats<T>{ zvec_block_rel_or_abs, iv, dmin, dmax, amin, amax,
+        (u32)runs, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 }
 
 template <typename T>
@@ -311,8 +452,8 @@ void ZVEC_ARCH_FN1(zvec_ll_block_synth_abs)(T * __restrict x, size_t N, T iv)
     }
 }
 
-template <typename T>
-void ZVEC_ARCH_FN1(zvec_ll_block_synth_rel)(T * __restrict x, size_t N, T iv, T dv)
+template <bool add, typename T>
+void ZVEC_ARCH_FN2(zvec_ll_block_synth,series)(T * __restrict x, size_t N, T iv, T dv)
 {
     ScalableTag<T> d;
 
@@ -327,10 +468,153 @@ void ZVEC_ARCH_FN1(zvec_ll_block_synth_rel)(T * __restrict x, size_t N, T iv, T
     for (size_t i = 0; i < N; i += L) {
         v2 = v1 + v0;
         v0 = TableLookupLanes(v2, shuf_last);
+        if constexpr (add) {
+            Store(Add(Load(d, x+i), v2), d, x+i);
+        } else {
+            Store(v2, d, x+i);
+        }
+    }
+}
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_synth_rel)(T * __restrict x, size_t N, T iv, T dv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_synth,series)<false,T>(x, N, iv, dv); }
+
+/* add the series iv + (i + 1) * dv to residuals, used by linear blocks */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_synth_add)(T * __restrict x, size_t N, T iv, T dv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_synth,series)<true,T>(x, N, iv, dv); }
+
+/* first-order deltas of x into y using iv as the element before x[0] */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_delta)(T * __restrict x, T * __restrict y, size_t N, T iv)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v0 = Set(d, iv), v1, v2;
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Load(d, x+i);
+        v2 = CombineShiftRightLanes<HWY_LANES(T)-1>(d, v1, v0);
+        v0 = v1;
+        Store(Sub(v1, v2), d, y+i);
+    }
+}
+
+/* in-place prefix sum of deltas starting from iv, the inverse of delta */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_integrate)(T * __restrict x, size_t N, T iv)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    const auto shuf_last = IndicesFromVec(d, Set(d, L - 1));
+
+    Vec<decltype(d)> v0 = Set(d, iv), v2;
+    for (size_t i = 0; i < N; i += L) {
+        v2 = Load(d, x+i);
+        constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
+            v2 = v2 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, v2, Zero(d));
+        });
+        v2 = v2 + v0;
+        v0 = TableLookupLanes(v2, shuf_last);
+        Store(v2, d, x+i);
+    }
+}
+
+/* in-place x = iv + x * g, using a shift when g is a power of two */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_scale)(T * __restrict x, size_t N, T iv, T g)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v0 = Set(d, iv), v1 = Set(d, g);
+    if (((U)g & ((U)g - 1)) == 0) {
+        int l = sizeof(T) == 8 ? ctz_u64((U)g) : ctz_u32((U)g);
+        for (size_t i = 0; i < N; i += L) {
+            Store(Add(ShiftLeftSame(Load(d, x+i), l), v0), d, x+i);
+        }
+    } else {
+        for (size_t i = 0; i < N; i += L) {
+            Store(Add(Mul(Load(d, x+i), v1), v0), d, x+i);
+        }
+    }
+}
+
+/* in-place lane-wise sum x += y, used to apply deltas to a reference page */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_add)(T * __restrict x, T * __restrict y, size_t N)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    for (size_t i = 0; i < N; i += L) {
+        Store(Add(Load(d, x+i), Load(d, y+i)), d, x+i);
+    }
+}
+
+/* xor of each element with its predecessor shifted right by s, iv before x[0] */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_xor_delta)(T * __restrict x, T * __restrict y, size_t N, T iv, int s)
+{
+    const ScalableTag<T> d;
+    const RebindToUnsigned<decltype(d)> du;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v0 = Set(d, iv), v1, v2;
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Load(d, x+i);
+        v2 = CombineShiftRightLanes<HWY_LANES(T)-1>(d, v1, v0);
+        v0 = v1;
+        Store(BitCast(d, ShiftRightSame(BitCast(du, Xor(v1, v2)), s)), d, y+i);
+    }
+}
+
+/* in-place prefix xor of elements shifted left by s from iv, the inverse of xor_delta */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_xor_prefix)(T * __restrict x, size_t N, T iv, int s)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    const auto shuf_last = IndicesFromVec(d, Set(d, L - 1));
+
+    Vec<decltype(d)> v0 = Set(d, iv), v2;
+    for (size_t i = 0; i < N; i += L) {
+        v2 = ShiftLeftSame(Load(d, x+i), s);
+        constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
+            v2 = Xor(v2, CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, v2, Zero(d)));
+        });
+        v2 = Xor(v2, v0);
+        v0 = TableLookupLanes(v2, shuf_last);
         Store(v2, d, x+i);
     }
 }
 
+/* in-place conversion of scaled integers in floating point lanes, x = m / p */
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_decimal)(T * __restrict x, size_t N, T p)
+{
+    const ScalableTag<T> d;
+    const RebindToSigned<decltype(d)> ds;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v0 = Set(d, p);
+    for (size_t i = 0; i < N; i += L) {
+        Store(Div(ConvertTo(d, BitCast(ds, Load(d, x+i))), v0), d, x+i);
+    }
+}
+
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_synth_both)(T * __restrict x, size_t N, T iv, T dv)
 {
@@ -358,6 +642,336 @@ void ZVEC_ARCH_FN1(zvec_ll_block_synth_both)(T * __restrict x, size_t N, T iv, T
     }
 }
 
+template <typename T>
+zvec_aggr<T> ZVEC_ARCH_FN1(zvec_ll_block_reduce)(T * __restrict x, size_t N)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v1;
+    Vec<decltype(d)> vsum = Zero(d);
+    Vec<decltype(d)> vmax = Set(d, zvec_lowest<T>());
+    Vec<decltype(d)> vmin = Set(d, zvec_highest<T>());
+
+    /* floating point min and max skip NaN, which propagates to the sum */
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Load(d, x+i);
+        vsum = Add(vsum, v1);
+        if constexpr (std::is_floating_point<T>::value) {
+            auto m = Eq(v1, v1);
+            vmin = IfThenElse(m, Min(vmin, v1), vmin);
+            vmax = IfThenElse(m, Max(vmax, v1), vmax);
+        } else {
+            vmin = Min(vmin, v1);
+            vmax = Max(vmax, v1);
+        }
+    }
+
+    T sum = ZVEC_ARCH_FN2(zvec_ll_lanes,sum)(d, vsum);
+    T min = ZVEC_ARCH_FN2(zvec_ll_lanes,min)(d, vmin);
+    T max = ZVEC_ARCH_FN2(zvec_ll_lanes,max)(d, vmax);
+
+    return zvec_aggr<T>{ sum, min, max };
+}
+
+template <typename T>
+size_t ZVEC_ARCH_FN1(zvec_ll_block_count)(T * __restrict x, size_t N, T lo, T hi)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(d)> v1;
+    Vec<decltype(d)> vlo = Set(d, lo);
+    Vec<decltype(d)> vhi = Set(d, hi);
+
+    size_t c = 0;
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Load(d, x+i);
+        auto m = Or(Lt(v1, vlo), Gt(v1, vhi));
+        if constexpr (std::is_floating_point<T>::value) m = Or(m, Ne(v1, v1));
+        c += CountTrue(d, m);
+    }
+
+    return N - c;
+}
+
+/* set bit i of the bitmap for elements in [lo, hi], returning the count */
+template <typename T>
+size_t ZVEC_ARCH_FN1(zvec_ll_block_match)(T * __restrict x, size_t N, T lo, T hi, u64 * __restrict bits)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+    const u64 lane_mask = L >= 64 ? ~0ull : (1ull << L) - 1;
+
+    Vec<decltype(d)> v1;
+    Vec<decltype(d)> vlo = Set(d, lo);
+    Vec<decltype(d)> vhi = Set(d, hi);
+
+    memset(bits, 0, ((N + 63) >> 6) << 3);
+
+    size_t c = 0;
+    for (size_t i = 0; i < N; i += L) {
+        alignas(8) u8 b[8] = { 0 };
+        u64 w;
+        v1 = Load(d, x+i);
+        auto m = Not(Or(Lt(v1, vlo), Gt(v1, vhi)));
+        if constexpr (std::is_floating_point<T>::value) m = And(m, Eq(v1, v1));
+        StoreMaskBits(d, m, b);
+        memcpy(&w, b, sizeof(w));
+        bits[i >> 6] |= (w & lane_mask) << (i & 63);
+        c += CountTrue(d, m);
+    }
+
+    return c;
+}
+
+/*
+ * reduce absolute blocks in the narrow domain. min and max are computed on
+ * full width vectors of the narrow type. 8-bit sums use octet sums of bytes
+ * biased to unsigned, wider sums are promoted one vector at a time. a tail
+ * shorter than a full narrow vector is reduced from promoted lanes.
+ */
+template <typename T, typename S>
+zvec_aggr<T> ZVEC_ARCH_FN1(zvec_ll_block_reduce_abs)(S * __restrict r, size_t N)
+{
+    const ScalableTag<T> d;
+    const ScalableTag<S> dn;
+    const ScalableTag<u8> b;
+    const ScalableTag<u64> q;
+    const Rebind<S, decltype(d)> dw;
+
+    const size_t L = Lanes(d);
+    const size_t K = Lanes(dn);
+    const u8 bias = std::is_signed<S>::value ? 0x80 : 0;
+
+    Vec<decltype(dn)> v1;
+    Vec<decltype(dn)> vmax = Set(dn, hwy::LowestValue<S>());
+    Vec<decltype(dn)> vmin = Set(dn, hwy::HighestValue<S>());
+    Vec<decltype(d)> v2;
+    Vec<decltype(d)> vsum = Zero(d);
+    Vec<decltype(d)> vtmax = Set(d, hwy::LowestValue<T>());
+    Vec<decltype(d)> vtmin = Set(d, hwy::HighestValue<T>());
+    Vec<decltype(q)> vsum8 = Zero(q);
+
+    size_t i = 0;
+    for (; i + K <= N; i += K) {
+        v1 = Load(dn, r+i);
+        vmin = Min(vmin, v1);
+        vmax = Max(vmax, v1);
+        if constexpr (sizeof(S) == 1) {
+            vsum8 = Add(vsum8, SumsOf8(Xor(BitCast(b, v1), Set(b, bias))));
+        } else {
+            for (size_t j = 0; j < K; j += L) {
+                vsum = Add(vsum, PromoteTo(d, Load(dw, r+i+j)));
+            }
+        }
+    }
+    size_t M = i;
+    for (; i < N; i += L) {
+        v2 = PromoteTo(d, Load(dw, r+i));
+        vsum = Add(vsum, v2);
+        vtmin = Min(vtmin, v2);
+        vtmax = Max(vtmax, v2);
+    }
+
+    alignas(64) S amin[K];
+    alignas(64) S amax[K];
+    Store(vmin, dn, amin);
+    Store(vmax, dn, amax);
+
+    T sum = GetLane(SumOfLanes(d, vsum));
+    T min = GetLane(MinOfLanes(d, vtmin));
+    T max = GetLane(MaxOfLanes(d, vtmax));
+    if constexpr (sizeof(S) == 1) {
+        sum += (T)(GetLane(SumOfLanes(q, vsum8)) - (u64)bias * M);
+    }
+    for (size_t j = 0; M > 0 && j < K; j++) {
+        min = std::min(min, (T)amin[j]);
+        max = std::max(max, (T)amax[j]);
+    }
+
+    return zvec_aggr<T>{ sum, min, max };
+}
+
+/* count absolute block elements in [lo, hi] where the bounds fit in S */
+template <typename T, typename S>
+size_t ZVEC_ARCH_FN1(zvec_ll_block_count_abs)(S * __restrict r, size_t N, S lo, S hi)
+{
+    const ScalableTag<T> d;
+    const ScalableTag<S> dn;
+    const Rebind<S, decltype(d)> dw;
+
+    const size_t L = Lanes(d);
+    const size_t K = Lanes(dn);
+
+    Vec<decltype(dn)> v1;
+    Vec<decltype(dn)> vlo = Set(dn, lo);
+    Vec<decltype(dn)> vhi = Set(dn, hi);
+    Vec<decltype(dw)> v2;
+    Vec<decltype(dw)> wlo = Set(dw, lo);
+    Vec<decltype(dw)> whi = Set(dw, hi);
+
+    size_t i = 0, c = 0;
+    for (; i + K <= N; i += K) {
+        v1 = Load(dn, r+i);
+        c += CountTrue(dn, Or(Lt(v1, vlo), Gt(v1, vhi)));
+    }
+    for (; i < N; i += L) {
+        v2 = Load(dw, r+i);
+        c += CountTrue(dw, Or(Lt(v2, wlo), Gt(v2, whi)));
+    }
+
+    return N - c;
+}
+
+/*
+ * elias-fano blocks for non-decreasing sequences. offsets from iv are split
+ * into l low bits packed in an array of N * l bits and high parts stored in
+ * unary by setting bit (offset >> l) + i of a 2N bit array, which holds if
+ * the largest offset >> l <= N. blocks are N * (l + 2) bits with N a
+ * multiple of 64. the vector kernels split and join offsets while the bit
+ * packing and the unary high parts are serial.
+ */
+
+static inline u64 zvec_ef_low(const u64 * __restrict r, size_t i, int l)
+{
+    if (l == 0) return 0;
+    size_t b = i * l, w = b >> 6, o = b & 63;
+    u64 v = r[w] >> o;
+    if (o + l > 64) v |= r[w + 1] << (64 - o);
+    return v & ((1ull << l) - 1);
+}
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_ef)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int l)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    const ScalableTag<U> d;
+
+    const size_t L = Lanes(d);
+
+    u64 *h = r + ((N * l) >> 6);
+    alignas(64) U hi[HWY_LANES(U)];
+    alignas(64) U lo[HWY_LANES(U)];
+
+    memset(r, 0, (N * (l + 2)) >> 3);
+
+    Vec<decltype(d)> v0 = Set(d, (U)iv);
+    Vec<decltype(d)> vm = Set(d, (U)((1ull << l) - 1));
+    Vec<decltype(d)> v1;
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Sub(Load(d, (U*)x + i), v0);
+        Store(ShiftRightSame(v1, l), d, hi);
+        Store(And(v1, vm), d, lo);
+        for (size_t j = 0; j < L; j++) {
+            size_t b = (i + j) * l, o = b & 63, p = (size_t)hi[j] + i + j;
+            if (l > 0) {
+                r[b >> 6] |= (u64)lo[j] << o;
+                if (o + l > 64) r[(b >> 6) + 1] |= (u64)lo[j] >> (64 - o);
+            }
+            h[p >> 6] |= 1ull << (p & 63);
+        }
+    }
+}
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_ef)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int l)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    const ScalableTag<U> d;
+
+    const size_t L = Lanes(d);
+
+    const u64 *h = r + ((N * l) >> 6);
+    alignas(64) U lo[HWY_LANES(U)];
+
+    /* high parts are set bit positions less their rank */
+    for (size_t w = 0, k = 0; w < (N >> 5) && k < N; w++) {
+        for (u64 m = h[w]; m && k < N; m &= m - 1, k++) {
+            ((U*)x)[k] = (U)((w << 6) + ctz_u64(m) - k);
+        }
+    }
+
+    Vec<decltype(d)> v0 = Set(d, (U)iv);
+    Vec<decltype(d)> v1;
+    for (size_t i = 0; i < N; i += L) {
+        for (size_t j = 0; j < L; j++) {
+            lo[j] = (U)zvec_ef_low(r, i + j, l);
+        }
+        v1 = Or(ShiftLeftSame(Load(d, (U*)x + i), l), Load(d, lo));
+        Store(Add(v1, v0), d, (U*)x + i);
+    }
+}
+
+/* element k of an elias-fano block, selecting its set bit by population count */
+template <typename T>
+T ZVEC_ARCH_FN1(zvec_ll_block_select_ef)(u64 * __restrict r, size_t N, T iv, int l, size_t k)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    const u64 *h = r + ((N * l) >> 6);
+
+    size_t w = 0, j = k, c;
+    while ((c = popcnt_u64(h[w])) <= j) {
+        j -= c;
+        w++;
+    }
+    u64 m = h[w];
+    while (j--) m &= m - 1;
+
+    U hi = (U)((w << 6) + ctz_u64(m) - k);
+    return (T)((U)iv + (U)((hi << l) | (U)zvec_ef_low(r, k, l)));
+}
+
+/*
+ * run-length blocks hold the value of each run followed by the u16 index
+ * of the last element of each run. runs are counted by the block scan
+ * and expanded with broadcast stores.
+ */
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_rle)(T * __restrict x, T * __restrict v, u16 * __restrict e, size_t R)
+{
+    const ScalableTag<T> d;
+
+    const size_t L = Lanes(d);
+
+    size_t i = 0;
+    for (size_t j = 0; j < R; j++) {
+        Vec<decltype(d)> v1 = Set(d, v[j]);
+        size_t end = (size_t)e[j] + 1;
+        for (; i + L <= end; i += L) {
+            StoreU(v1, d, x+i);
+        }
+        for (; i < end; i++) {
+            x[i] = v[j];
+        }
+    }
+}
+
+/*
+ * dictionary blocks hold packed indices into a table of distinct values.
+ * indices are unpacked in place and replaced with gathers from the table.
+ */
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_dict)(T * __restrict x, T * __restrict t, size_t N)
+{
+    const ScalableTag<T> d;
+    const RebindToSigned<decltype(d)> ds;
+
+    const size_t L = Lanes(d);
+
+    for (size_t i = 0; i < N; i += L) {
+        Store(GatherIndex(d, t, BitCast(ds, Load(d, x+i))), d, x+i);
+    }
+}
+
 template <typename T, typename S>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_abs)(T * __restrict x, S * __restrict r, size_t N)
 {
@@ -393,7 +1007,7 @@ void ZVEC_ARCH_FN1(zvec_ll_block_encode_abs)(T * __restrict x, S * __restrict r,
             }
         }
     }
-    if constexpr (sizeof(T) == 4)
+    if constexpr (sizeof(T) == 4 || sizeof(T) == 2)
     {
         const size_t L = Lanes(d);
 
@@ -464,7 +1078,7 @@ void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)(T * __restrict x, S * __restrict r,
             }
         }
     }
-    if constexpr (sizeof(T) == 4)
+    if constexpr (sizeof(T) == 4 || sizeof(T) == 2)
     {
         const size_t L = Lanes(d);
 
@@ -484,7 +1098,36 @@ template <typename T, typename S>
 void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, S * __restrict r, size_t N, T iv)
 {
     const ScalableTag<T> d;
+    const RebindToSigned<decltype(d)> ds;
+    const Rebind<S, decltype(d)> dw;
+    const RebindToSigned<decltype(dw)> dws;
+
+    const size_t L = Lanes(d);
+
+    const auto shuf_last = IndicesFromVec(d, Set(d, L - 1));
+
+    Vec<decltype(dw)> v1;
+    Vec<decltype(d)> v0 = Set(d, iv), v2;
+    for (size_t i = 0; i < N; i += L) {
+    	v1 = Load(dw, r+i);
+    	/* deltas are signed for unsigned types */
+    	v2 = BitCast(d, PromoteTo(ds, BitCast(dws, v1)));
+    	constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
+    	 	v2 = v2 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, v2, Zero(d));
+    	});
+    	v2 = v2 + v0;
+        v0 = TableLookupLanes(v2, shuf_last);
+    	Store(v2, d, x+i);
+    }
+}
+
+template <typename T, typename S>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)(T * __restrict x, S * __restrict r, size_t N, T iv)
+{
+    const ScalableTag<T> d;
+    const RebindToUnsigned<decltype(d)> du;
     const Rebind<S, decltype(d)> dw;
+    const RebindToUnsigned<decltype(dw)> dwu;
 
     const size_t L = Lanes(d);
 
@@ -494,7 +1137,8 @@ void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, S * __restrict r,
     Vec<decltype(d)> v0 = Set(d, iv), v2;
     for (size_t i = 0; i < N; i += L) {
     	v1 = Load(dw, r+i);
-    	v2 = PromoteTo(d, v1);
+    	/* deltas are unsigned for non-decreasing blocks */
+    	v2 = BitCast(d, PromoteTo(du, BitCast(dwu, v1)));
     	constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
     	 	v2 = v2 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, v2, Zero(d));
     	});
@@ -504,6 +1148,200 @@ void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, S * __restrict r,
     }
 }
 
+template <typename T, typename S>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for)(T * __restrict x, S * __restrict r, size_t N, T iv)
+{
+    using x32 = typename std::conditional<std::is_signed<T>::value,i32,u32>::type;
+
+    const ScalableTag<T> d;
+    const RebindToUnsigned<decltype(d)> du;
+    const ScalableTag<x32> w;
+    const ScalableTag<u32> wu;
+    const Rebind<S, decltype(d)> dw;
+    const RebindToUnsigned<decltype(dw)> dwu;
+
+    if constexpr (sizeof(T) == 8)
+    {
+        const size_t L = Lanes(d);
+        const size_t K = Lanes(w);
+
+        alignas(64) i32 idx_demote[K];
+        for (size_t i = 0; i < K; i++) {
+            idx_demote[i] = i % L * (K/L); /* little-endian dword-0 */
+        }
+        const auto shuf_demote = SetTableIndices(w, idx_demote);
+
+        Vec<decltype(d)> v0 = Set(d, iv);
+        Vec<decltype(d)> v1;
+        Vec<decltype(w)> v2;
+        for (size_t i = 0; i < N; i += L) {
+            v1 = Sub(Load(d, x+i), v0);
+            v2 = TableLookupLanes(BitCast(w, v1), shuf_demote);
+            if constexpr (sizeof(S) == 4) {
+                Store(LowerHalf(v2), dw, r+i);
+            } else {
+                Store(BitCast(dw, TruncateTo(dwu, LowerHalf(BitCast(wu, v2)))), dw, r+i);
+            }
+        }
+    }
+    if constexpr (sizeof(T) == 4)
+    {
+        const size_t L = Lanes(d);
+
+        Vec<decltype(d)> v0 = Set(d, iv);
+        Vec<decltype(d)> v1;
+        for (size_t i = 0; i < N; i += L) {
+            v1 = Sub(Load(d, x+i), v0);
+            Store(BitCast(dw, TruncateTo(dwu, BitCast(du, v1))), dw, r+i);
+        }
+    }
+}
+
+template <typename T, typename S>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for)(T * __restrict x, S * __restrict r, size_t N, T iv)
+{
+    const ScalableTag<T> d;
+    const RebindToUnsigned<decltype(d)> du;
+    const Rebind<S, decltype(d)> dw;
+    const RebindToUnsigned<decltype(dw)> dwu;
+
+    const size_t L = Lanes(d);
+
+    Vec<decltype(dw)> v1;
+    Vec<decltype(d)> v0 = Set(d, iv), v2;
+    for (size_t i = 0; i < N; i += L) {
+        v1 = Load(dw, r+i);
+        /* offsets from the base are unsigned */
+        v2 = BitCast(d, PromoteTo(du, BitCast(dwu, v1)));
+        Store(Add(v2, v0), d, x+i);
+    }
+}
+
+/*
+ * bit packed blocks of b bits per element for widths from 1 to 64 bits.
+ * elements are striped across the lanes of a 512-bit row so that row m
+ * holds elements [m * S, m * S + S) and each lane accumulates the bits of
+ * the elements in its column in sequence. narrower vectors pack each part
+ * of the row in turn so the layout is the same for all targets. blocks
+ * are N * b bits where N is a multiple of 64 rows.
+ */
+template<zvec_codec codec, typename T>
+void ZVEC_ARCH_FN2(zvec_ll_block_encode,bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    constexpr size_t W = sizeof(T) * 8, S = 64 / sizeof(T);
+
+    const ScalableTag<U> d;
+
+    const size_t L = Lanes(d);
+
+    const U mask = b >= (int)W ? (U)~(U)0 : (U)(((U)1 << b) - 1);
+
+    Vec<decltype(d)> v0 = Set(d, (U)iv);
+    Vec<decltype(d)> vm = Set(d, mask);
+    Vec<decltype(d)> v1, v2;
+    for (size_t k = 0; k < S; k += L) {
+        size_t o = 0, w = 0;
+        v2 = Zero(d);
+        for (size_t i = k; i < N; i += S) {
+            v1 = Load(d, (U*)x + i);
+            if constexpr (zvec_codec_delta(codec)) {
+                v1 = Sub(v1, i == 0 ? CombineShiftRightLanes<HWY_LANES(U)-1>(d, v1, v0)
+                                    : LoadU(d, (U*)x + i - 1));
+            } else if constexpr (zvec_codec_base(codec)) {
+                v1 = Sub(v1, v0);
+            }
+            v1 = And(v1, vm);
+            v2 = Or(v2, ShiftLeftSame(v1, (int)o));
+            o += b;
+            if (o >= W) {
+                Store(v2, d, (U*)r + w * S + k);
+                o -= W;
+                w++;
+                v2 = o > 0 ? ShiftRightSame(v1, (int)(b - o)) : Zero(d);
+            }
+        }
+    }
+}
+
+template<zvec_codec codec, typename T>
+void ZVEC_ARCH_FN2(zvec_ll_block_decode,bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    constexpr size_t W = sizeof(T) * 8, S = 64 / sizeof(T);
+
+    const ScalableTag<U> d;
+    const RebindToSigned<decltype(d)> ds;
+
+    const size_t L = Lanes(d);
+
+    const U mask = b >= (int)W ? (U)~(U)0 : (U)(((U)1 << b) - 1);
+
+    Vec<decltype(d)> v0 = Set(d, (U)iv);
+    Vec<decltype(d)> vm = Set(d, mask);
+    Vec<decltype(d)> v1, v2;
+    for (size_t k = 0; k < S; k += L) {
+        size_t o = 0, w = 0;
+        v2 = Load(d, (U*)r + k);
+        for (size_t i = k; i < N; i += S) {
+            v1 = ShiftRightSame(v2, (int)o);
+            o += b;
+            if (o >= W) {
+                o -= W;
+                w++;
+                if (i + S < N) v2 = Load(d, (U*)r + w * S + k);
+                if (o > 0) v1 = Or(v1, ShiftLeftSame(v2, (int)(b - o)));
+            }
+            v1 = And(v1, vm);
+            if constexpr (zvec_codec_sext<T>(codec)) {
+                v1 = BitCast(d, ShiftRightSame(ShiftLeftSame(BitCast(ds, v1), (int)(W - b)), (int)(W - b)));
+            } else if constexpr (zvec_codec_base(codec)) {
+                v1 = Add(v1, v0);
+            }
+            Store(v1, d, (U*)x + i);
+        }
+    }
+
+    if constexpr (zvec_codec_delta(codec))
+    {
+        const auto shuf_last = IndicesFromVec(d, Set(d, L - 1));
+
+        for (size_t i = 0; i < N; i += L) {
+            v1 = Load(d, (U*)x + i);
+            constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
+                v1 = v1 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, v1, Zero(d));
+            });
+            v1 = v1 + v0;
+            v0 = TableLookupLanes(v1, shuf_last);
+            Store(v1, d, (U*)x + i);
+        }
+    }
+}
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_abs_bits)(T * __restrict x, u64 * __restrict r, size_t N, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,bits)<zvec_block_abs,T>(x, r, N, 0, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_abs_bits)(T * __restrict x, u64 * __restrict r, size_t N, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,bits)<zvec_block_abs,T>(x, r, N, 0, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel_bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,bits)<zvec_block_rel,T>(x, r, N, iv, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel_bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,bits)<zvec_block_rel,T>(x, r, N, iv, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono_bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,bits)<zvec_block_mono,T>(x, r, N, iv, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for_bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,bits)<zvec_block_for,T>(x, r, N, iv, b); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for_bits)(T * __restrict x, u64 * __restrict r, size_t N, T iv, int b)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,bits)<zvec_block_for,T>(x, r, N, iv, b); }
+
 #if defined(ZVECTOR_USE_SCALAR)
 
 template<zvec_codec codec, typename T>
@@ -513,7 +1351,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
     T d0, d1, d2, d3, w0, w1, w2, w3;
     for (size_t i = 0, j = 0; i < N; i += 4, j += 3)
     {
-        if constexpr (codec == zvec_block_rel)
+        if constexpr (zvec_codec_delta(codec))
         {
             d0 = x[i + 0];
             d1 = x[i + 1];
@@ -526,6 +1364,11 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
             w3 = d3 - d2;
 
             v0 = d3;
+        } else if constexpr (zvec_codec_base(codec)) {
+            w0 = x[i + 0] - v0;
+            w1 = x[i + 1] - v0;
+            w2 = x[i + 2] - v0;
+            w3 = x[i + 3] - v0;
         } else {
             w0 = x[i + 0];
             w1 = x[i + 1];
@@ -557,25 +1400,27 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
         s0 =                          (r0 & 0xffffff);
         s1 = ((r0 >> 24) & 0xff)   | ((r1 & 0xffff) << 8);
         s2 = ((r1 >> 16) & 0xffff) | ((r2 & 0xff) << 16);
-        s3 =  (r2 >> 8);
+        s3 =  (r2 >> 8)            & 0xffffff;
 
-        if constexpr (std::is_signed<T>::value && sizeof(T) == 8)
+        if constexpr (zvec_codec_sext<T>(codec) && sizeof(T) == 8)
         {
-            s0 = (s0 << 40) >> 40;
-            s1 = (s1 << 40) >> 40;
-            s2 = (s2 << 40) >> 40;
-            s3 = (s3 << 40) >> 40;
+            using TS = typename std::make_signed<T>::type;
+            s0 = (TS)(s0 << 40) >> 40;
+            s1 = (TS)(s1 << 40) >> 40;
+            s2 = (TS)(s2 << 40) >> 40;
+            s3 = (TS)(s3 << 40) >> 40;
         }
 
-        if constexpr (std::is_signed<T>::value && sizeof(T) == 4)
+        if constexpr (zvec_codec_sext<T>(codec) && sizeof(T) == 4)
         {
-            s0 = (s0 << 8) >> 8;
-            s1 = (s1 << 8) >> 8;
-            s2 = (s2 << 8) >> 8;
-            s3 = (s3 << 8) >> 8;
+            using TS = typename std::make_signed<T>::type;
+            s0 = (TS)(s0 << 8) >> 8;
+            s1 = (TS)(s1 << 8) >> 8;
+            s2 = (TS)(s2 << 8) >> 8;
+            s3 = (TS)(s3 << 8) >> 8;
         }
 
-        if constexpr (codec == zvec_block_rel)
+        if constexpr (zvec_codec_delta(codec))
         {
             s0 += v0;
             s1 += s0;
@@ -585,6 +1430,14 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
             v0 = s3;
         }
 
+        if constexpr (zvec_codec_base(codec))
+        {
+            s0 += v0;
+            s1 += v0;
+            s2 += v0;
+            s3 += v0;
+        }
+
         x[i + 0] = s0;
         x[i + 1] = s1;
         x[i + 2] = s2;
@@ -599,7 +1452,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)(T * __restrict x, typename std::con
     T d0, d1, d2, d3, w0, w1, w2, w3;
     for (size_t i = 0, j = 0; i < N; i += 4, j += 3)
     {
-        if constexpr (codec == zvec_block_rel)
+        if constexpr (zvec_codec_delta(codec))
         {
             d0 = x[i + 0];
             d1 = x[i + 1];
@@ -612,6 +1465,11 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)(T * __restrict x, typename std::con
             w3 = d3 - d2;
 
             v0 = d3;
+        } else if constexpr (zvec_codec_base(codec)) {
+            w0 = x[i + 0] - v0;
+            w1 = x[i + 1] - v0;
+            w2 = x[i + 2] - v0;
+            w3 = x[i + 3] - v0;
         } else {
             w0 = x[i + 0];
             w1 = x[i + 1];
@@ -643,17 +1501,18 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
         s0 =                                 (r0 & 0xffffffffffffull);
         s1 = ((r0 >> 48) & 0xffffull)     | ((r1 & 0xffffffffull) << 16);
         s2 = ((r1 >> 32) & 0xffffffffull) | ((r2 & 0xffffull) << 32);
-        s3 =  (r2 >> 16);
+        s3 =  (r2 >> 16)                 & 0xffffffffffffull;
 
-        if constexpr (std::is_signed<T>::value && sizeof(T) == 8)
+        if constexpr (zvec_codec_sext<T>(codec) && sizeof(T) == 8)
         {
-            s0 = (s0 << 16) >> 16;
-            s1 = (s1 << 16) >> 16;
-            s2 = (s2 << 16) >> 16;
-            s3 = (s3 << 16) >> 16;
+            using TS = typename std::make_signed<T>::type;
+            s0 = (TS)(s0 << 16) >> 16;
+            s1 = (TS)(s1 << 16) >> 16;
+            s2 = (TS)(s2 << 16) >> 16;
+            s3 = (TS)(s3 << 16) >> 16;
         }
 
-        if constexpr (codec == zvec_block_rel)
+        if constexpr (zvec_codec_delta(codec))
         {
             s0 += v0;
             s1 += s0;
@@ -663,6 +1522,14 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
             v0 = s3;
         }
 
+        if constexpr (zvec_codec_base(codec))
+        {
+            s0 += v0;
+            s1 += v0;
+            s2 += v0;
+            s3 += v0;
+        }
+
         x[i + 0] = s0;
         x[i + 1] = s1;
         x[i + 2] = s2;
@@ -739,7 +1606,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
         Vec<decltype(w)> r0, r1, r2, r3;
         for (size_t i = 0, j = 0; i < N; i += L * 4, j+= L * 3)
         {
-            if constexpr (codec == zvec_block_rel)
+            if constexpr (zvec_codec_delta(codec))
             {
                 auto d0 = delta(i + L * 0, v0);
                 auto d1 = delta(i + L * 1, std::get<0>(d0));
@@ -753,6 +1620,13 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
                 w2 = convert24(std::get<1>(d2));
                 w3 = convert24(std::get<1>(d3));
             }
+            else if constexpr (zvec_codec_base(codec))
+            {
+                w0 = convert24(Sub(Load(d, x + i + L * 0), v0));
+                w1 = convert24(Sub(Load(d, x + i + L * 1), v0));
+                w2 = convert24(Sub(Load(d, x + i + L * 2), v0));
+                w3 = convert24(Sub(Load(d, x + i + L * 3), v0));
+            }
             else
             {
                 w0 = convert24(Load(d, x + i + L * 0));
@@ -845,7 +1719,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
         Vec<decltype(d)> r0, r1, r2, r3;
         for (size_t i = 0, j = 0; i < N; i += L * 4, j+= L * 3)
         {
-            if constexpr (codec == zvec_block_rel)
+            if constexpr (zvec_codec_delta(codec))
             {
                 auto d0 = delta(i + L * 0, v0);
                 auto d1 = delta(i + L * 1, std::get<0>(d0));
@@ -859,6 +1733,13 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)(T * __restrict x, typename std::con
                 w2 = convert24(std::get<1>(d2));
                 w3 = convert24(std::get<1>(d3));
             }
+            else if constexpr (zvec_codec_base(codec))
+            {
+                w0 = convert24(Sub(Load(d, x + i + L * 0), v0));
+                w1 = convert24(Sub(Load(d, x + i + L * 1), v0));
+                w2 = convert24(Sub(Load(d, x + i + L * 2), v0));
+                w3 = convert24(Sub(Load(d, x + i + L * 3), v0));
+            }
             else
             {
                 w0 = convert24(Load(d, x + i + L * 0));
@@ -912,6 +1793,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
         const ScalableTag<i8> b;
         const Rebind<x32, decltype(d)> dw;
         const RebindToSigned<decltype(dw)> dws;
+        const RebindToUnsigned<decltype(dw)> dwu;
         const Repartition<i8, decltype(dw)> db;
 
         const size_t L = Lanes(d);
@@ -933,40 +1815,38 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
         if constexpr (HWY_LANES(i8) > 16) {
             for (size_t i = 0; i < V; i++) {
                 i8 x = (i % 4) + (i / 4) * 3;
-                if (std::is_signed<T>::value || codec == zvec_block_rel) {
-                    idx_mask[(i+1)&(V-1)] = (x / 16) == (i / 16) ? -1 : 0;
-                } else {
-                    idx_mask[i] = (x / 16) == (i / 16) ? -1 : 0;
-                }
+                idx_mask[(i+1)&(V-1)] = (x / 16) == (int)(i / 16) ? -1 : 0;
             }
             shuf_mask = MaskFromVec(Load(db, idx_mask));
         }
 
         auto convert24 = [&] (Vec<decltype(dw)> v) -> Vec<decltype(dw)>
         {
-            if constexpr (std::is_signed<T>::value || codec == zvec_block_rel)
-            {
-                if constexpr (HWY_LANES(i8) > 16) {
-                    Vec<decltype(dw)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(dw, v, Zero(dw));
-                    return BitCast(dw, ShiftRight<8>(BitCast(dws, IfThenElse(shuf_mask,
-                        TableLookupBytes(BitCast(db, v), shuf_dec),
-                        TableLookupBytes(BitCast(db, u), shuf_dec)))));
-                } else if constexpr (HWY_LANES(i8) == 16) {
-                    return BitCast(dw, ShiftRight<8>(BitCast(dws,
-                        TableLookupBytes(BitCast(db, v), shuf_dec))));
-                }
+            Vec<decltype(dw)> t;
+            if constexpr (HWY_LANES(i8) > 16) {
+                Vec<decltype(dw)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(dw, v, Zero(dw));
+                t = BitCast(dw, IfThenElse(shuf_mask,
+                    TableLookupBytes(BitCast(db, v), shuf_dec),
+                    TableLookupBytes(BitCast(db, u), shuf_dec)));
+            } else if constexpr (HWY_LANES(i8) == 16) {
+                t = BitCast(dw, TableLookupBytes(BitCast(db, v), shuf_dec));
             }
-            else
-            {
-                if constexpr (HWY_LANES(i8) > 16) {
-                    Vec<decltype(dw)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(dw, v, Zero(dw));
-                    return BitCast(dw, IfThenElse(shuf_mask,
-                        TableLookupBytes(BitCast(db, v), shuf_dec),
-                        TableLookupBytes(BitCast(db, u), shuf_dec)));
-                } else if constexpr (HWY_LANES(i8) == 16) {
-                    return BitCast(dw,
-                        TableLookupBytes(BitCast(db, v), shuf_dec));
-                }
+            /* bytes are placed high so the shift either sign or zero extends */
+            if constexpr (zvec_codec_sext<T>(codec)) {
+                return BitCast(dw, ShiftRight<8>(BitCast(dws, t)));
+            } else {
+                return BitCast(dw, ShiftRight<8>(BitCast(dwu, t)));
+            }
+        };
+
+        /* unsigned types promote sign extended deltas as signed */
+        auto promote24 = [&] (Vec<decltype(dw)> v) -> Vec<decltype(d)>
+        {
+            if constexpr (zvec_codec_sext<T>(codec)) {
+                const RebindToSigned<decltype(d)> ds;
+                return BitCast(d, PromoteTo(ds, BitCast(dws, v)));
+            } else {
+                return PromoteTo(d, v);
             }
         };
 
@@ -1004,17 +1884,17 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
                 w3 = BitCast(w, CombineShiftRightBytes<2>(b, Zero(b), BitCast(b, r2)));
             }
 
-            d0 = PromoteTo(d, convert24(LowerHalf(dw, w0)));
-            d1 = PromoteTo(d, convert24(LowerHalf(dw, w1)));
-            d2 = PromoteTo(d, convert24(LowerHalf(dw, w2)));
-            d3 = PromoteTo(d, convert24(LowerHalf(dw, w3)));
+            d0 = promote24(convert24(LowerHalf(dw, w0)));
+            d1 = promote24(convert24(LowerHalf(dw, w1)));
+            d2 = promote24(convert24(LowerHalf(dw, w2)));
+            d3 = promote24(convert24(LowerHalf(dw, w3)));
 
             s0 = d0;
             s1 = d1;
             s2 = d2;
             s3 = d3;
 
-            if (codec == zvec_block_rel)
+            if (zvec_codec_delta(codec))
             {
                 constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
                     s0 = s0 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, s0, Zero(d));
@@ -1030,6 +1910,14 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
                 v0 = TableLookupLanes(s3, shuf_last);
             }
 
+            if constexpr (zvec_codec_base(codec))
+            {
+                s0 = s0 + v0;
+                s1 = s1 + v0;
+                s2 = s2 + v0;
+                s3 = s3 + v0;
+            }
+
             Store(s0, d, x + i + L * 0);
             Store(s1, d, x + i + L * 1);
             Store(s2, d, x + i + L * 2);
@@ -1044,6 +1932,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
         const ScalableTag<i32> w;
         const ScalableTag<i8> b;
         const RebindToSigned<decltype(d)> ds;
+        const RebindToUnsigned<decltype(d)> du;
         const Repartition<i8, decltype(d)> db;
 
         const size_t L = Lanes(d);
@@ -1065,40 +1954,27 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
         if constexpr (HWY_LANES(i8) > 16) {
             for (size_t i = 0; i < V; i++) {
                 i8 x = (i % 4) + (i / 4) * 3;
-                if (std::is_signed<T>::value || codec == zvec_block_rel) {
-                    idx_mask[(i+1)&(V-1)] = (x / 16) == (i / 16) ? -1 : 0;
-                } else {
-                    idx_mask[i] = (x / 16) == (i / 16) ? -1 : 0;
-                }
+                idx_mask[(i+1)&(V-1)] = (x / 16) == (int)(i / 16) ? -1 : 0;
             }
             shuf_mask = MaskFromVec(Load(db, idx_mask));
         }
 
         auto convert24 = [&] (Vec<decltype(d)> v) -> Vec<decltype(d)>
         {
-            if constexpr (std::is_signed<T>::value || codec == zvec_block_rel)
-            {
-                if constexpr (HWY_LANES(i8) > 16) {
-                    Vec<decltype(d)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(d, v, Zero(d));
-                    return BitCast(d, ShiftRight<8>(BitCast(ds, IfThenElse(shuf_mask,
-                        TableLookupBytes(BitCast(db, v), shuf_dec),
-                        TableLookupBytes(BitCast(db, u), shuf_dec)))));
-                } else if constexpr (HWY_LANES(i8) == 16) {
-                    return BitCast(d, ShiftRight<8>(BitCast(ds,
-                        TableLookupBytes(BitCast(db, v), shuf_dec))));
-                }
+            Vec<decltype(d)> t;
+            if constexpr (HWY_LANES(i8) > 16) {
+                Vec<decltype(d)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(d, v, Zero(d));
+                t = BitCast(d, IfThenElse(shuf_mask,
+                    TableLookupBytes(BitCast(db, v), shuf_dec),
+                    TableLookupBytes(BitCast(db, u), shuf_dec)));
+            } else if constexpr (HWY_LANES(i8) == 16) {
+                t = BitCast(d, TableLookupBytes(BitCast(db, v), shuf_dec));
             }
-            else
-            {
-                if constexpr (HWY_LANES(i8) > 16) {
-                    Vec<decltype(d)> u = CombineShiftRightLanes<HWY_LANES(i32)-4>(d, v, Zero(d));
-                    return BitCast(d, IfThenElse(shuf_mask,
-                        TableLookupBytes(BitCast(db, v), shuf_dec),
-                        TableLookupBytes(BitCast(db, u), shuf_dec)));
-                } else if constexpr (HWY_LANES(i8) == 16) {
-                    return BitCast(d,
-                        TableLookupBytes(BitCast(db, v), shuf_dec));
-                }
+            /* bytes are placed high so the shift either sign or zero extends */
+            if constexpr (zvec_codec_sext<T>(codec)) {
+                return BitCast(d, ShiftRight<8>(BitCast(ds, t)));
+            } else {
+                return BitCast(d, ShiftRight<8>(BitCast(du, t)));
             }
         };
 
@@ -1146,7 +2022,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
             s2 = d2;
             s3 = d3;
 
-            if (codec == zvec_block_rel)
+            if (zvec_codec_delta(codec))
             {
                 constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
                     s0 = s0 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, s0, Zero(d));
@@ -1162,6 +2038,14 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)(T * __restrict x, typename std::con
                 v0 = TableLookupLanes(s3, shuf_last);
             }
 
+            if constexpr (zvec_codec_base(codec))
+            {
+                s0 = s0 + v0;
+                s1 = s1 + v0;
+                s2 = s2 + v0;
+                s3 = s3 + v0;
+            }
+
             Store(s0, d, x + i + L * 0);
             Store(s1, d, x + i + L * 1);
             Store(s2, d, x + i + L * 2);
@@ -1225,7 +2109,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)(T * __restrict x, typename std::con
     Vec<decltype(d)> r0, r1, r2;
     for (size_t i = 0, j = 0; i < N; i += L * 4, j+= L * 3)
     {
-        if constexpr (codec == zvec_block_rel)
+        if constexpr (zvec_codec_delta(codec))
         {
             auto d0 = delta(i + L * 0, v0);
             auto d1 = delta(i + L * 1, std::get<0>(d0));
@@ -1239,12 +2123,19 @@ void ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)(T * __restrict x, typename std::con
             w2 = convert48(std::get<1>(d2));
             w3 = convert48(std::get<1>(d3));
         }
+        else if constexpr (zvec_codec_base(codec))
+        {
+            w0 = convert48(Sub(Load(d, x + i + L * 0), v0));
+            w1 = convert48(Sub(Load(d, x + i + L * 1), v0));
+            w2 = convert48(Sub(Load(d, x + i + L * 2), v0));
+            w3 = convert48(Sub(Load(d, x + i + L * 3), v0));
+        }
         else
         {
             w0 = convert48(Load(d, x + i + L * 0));
             w1 = convert48(Load(d, x + i + L * 1));
             w2 = convert48(Load(d, x + i + L * 2));
-            w3 = convert48(Load(d, x + i + L * 3));            
+            w3 = convert48(Load(d, x + i + L * 3));
         }
 
         if constexpr (HWY_LANES(i8) == 64)
@@ -1285,6 +2176,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
 
     const ScalableTag<T> d;
     const RebindToSigned<decltype(d)> ds;
+    const RebindToUnsigned<decltype(d)> du;
     const ScalableTag<i32> w;
     const ScalableTag<i16> s;
     const ScalableTag<i8> b;
@@ -1304,11 +2196,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
     {
         for (size_t i = 0; i < W; i++) {
             i16 x = (i % 4) + (i / 4) * 3;
-            if (std::is_signed<T>::value || codec == zvec_block_rel) {
-                idx_decs[(i+1)&(W-1)] = (i % 4) < 3 ? x : -1;
-            } else {
-                idx_decs[i] = (i % 4) < 3 ? x : -1;
-            }
+            idx_decs[(i+1)&(W-1)] = (i % 4) < 3 ? x : -1;
         }
         shuf_decs = Load(s, idx_decs);
     }
@@ -1316,32 +2204,24 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
     {
         for (size_t i = 0; i < V; i++) {
             i8 x = (i % 8) + (i / 8) * 6;
-            if (std::is_signed<T>::value || codec == zvec_block_rel) {
-                idx_decb[(i+2)&(V-1)] = (i % 8) < 6 ? x : -1;
-            } else {
-                idx_decb[i] = (i % 8) < 6 ? x : -1;
-            }
+            idx_decb[(i+2)&(V-1)] = (i % 8) < 6 ? x : -1;
         }
         shuf_decb = Load(b, idx_decb);
     }
 
     auto convert48 = [&] (Vec<decltype(d)> v) -> Vec<decltype(d)>
     {
-        if (std::is_signed<T>::value || codec == zvec_block_rel)
-        {
-            if constexpr (HWY_LANES(i8) > 16) {
-                return BitCast(d, ShiftRight<16>(BitCast(ds, TableLookupLanes(BitCast(s, v), IndicesFromVec(s, shuf_decs)))));
-            } else if constexpr (HWY_LANES(i8) == 16) {
-                return BitCast(d, ShiftRight<16>(BitCast(ds, TableLookupBytes(BitCast(b, v), shuf_decb))));
-            }
+        Vec<decltype(d)> t;
+        if constexpr (HWY_LANES(i8) > 16) {
+            t = BitCast(d, TableLookupLanes(BitCast(s, v), IndicesFromVec(s, shuf_decs)));
+        } else if constexpr (HWY_LANES(i8) == 16) {
+            t = BitCast(d, TableLookupBytes(BitCast(b, v), shuf_decb));
         }
-        else
-        {
-            if constexpr (HWY_LANES(i8) > 16) {
-                return BitCast(d, TableLookupLanes(BitCast(s, v), IndicesFromVec(s, shuf_decs)));
-            } else if constexpr (HWY_LANES(i8) == 16) {
-                return BitCast(d, TableLookupBytes(BitCast(b, v), shuf_decb));
-            }
+        /* words are placed high so the shift either sign or zero extends */
+        if constexpr (zvec_codec_sext<T>(codec)) {
+            return BitCast(d, ShiftRight<16>(BitCast(ds, t)));
+        } else {
+            return BitCast(d, ShiftRight<16>(BitCast(du, t)));
         }
     };
 
@@ -1389,7 +2269,7 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
         s2 = d2;
         s3 = d3;
 
-        if (codec == zvec_block_rel)
+        if (zvec_codec_delta(codec))
         {
             constexpr_for<0, ilog2(HWY_LANES(T)), 1>([&](auto j){
                 s0 = s0 + CombineShiftRightLanes<HWY_LANES(T)-(1 << j)>(d, s0, Zero(d));
@@ -1405,6 +2285,14 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
             v0 = TableLookupLanes(s3, shuf_last);
         }
 
+        if constexpr (zvec_codec_base(codec))
+        {
+            s0 = s0 + v0;
+            s1 = s1 + v0;
+            s2 = s2 + v0;
+            s3 = s3 + v0;
+        }
+
         Store(s0, d, x + i + L * 0);
         Store(s1, d, x + i + L * 1);
         Store(s2, d, x + i + L * 2);
@@ -1414,6 +2302,96 @@ void ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)(T * __restrict x, typename std::con
 
 #endif
 
+/*
+ * stream vbyte blocks hold a control stream of 2-bit codes for each offset
+ * followed by a data stream with the low bytes of each offset. codes are
+ * 1, 2, 3 or 4 bytes for 32-bit types and 1, 2, 4 or 8 bytes for 64-bit
+ * types. a control byte holds the codes of four 32-bit offsets or a nibble
+ * holds the codes of two 64-bit offsets, and selects a byte shuffle that
+ * spreads the next 16 data bytes to the lanes of a 128-bit vector. the
+ * data stream is padded so that the last 16 byte load stays in the block.
+ */
+template <typename T>
+constexpr size_t zvec_svb_len(unsigned c)
+{
+    return sizeof(T) == 8 ? (size_t)1 << c : (size_t)c + 1;
+}
+
+template <typename T>
+struct zvec_svb_table
+{
+    enum : size_t { K = 16 / sizeof(T), C = (size_t)1 << (K * 2) };
+
+    alignas(16) u8 shuf[C][16];
+    u8 len[C];
+
+    zvec_svb_table()
+    {
+        for (size_t c = 0; c < C; c++) {
+            size_t o = 0;
+            for (size_t e = 0; e < K; e++) {
+                size_t l = zvec_svb_len<T>((c >> (e * 2)) & 3);
+                for (size_t k = 0; k < sizeof(T); k++) {
+                    shuf[c][e * sizeof(T) + k] = k < l ? (u8)(o + k) : 0x80;
+                }
+                o += l;
+            }
+            len[c] = (u8)o;
+        }
+    }
+};
+
+template <typename T>
+const zvec_svb_table<T>& zvec_svb_tables()
+{
+    static const zvec_svb_table<T> t;
+    return t;
+}
+
+#if defined(ZVECTOR_USE_SCALAR)
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_svb)(T * __restrict x, u8 * __restrict r, size_t N, T iv)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    const u8 *p = r + N / 4;
+    for (size_t i = 0; i < N; i++) {
+        size_t l = zvec_svb_len<T>((r[i >> 2] >> ((i & 3) << 1)) & 3);
+        U o = 0;
+        memcpy(&o, p, l);
+        x[i] = (T)((U)iv + o);
+        p += l;
+    }
+}
+
+#else
+
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_svb)(T * __restrict x, u8 * __restrict r, size_t N, T iv)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    constexpr size_t K = 16 / sizeof(T);
+
+    const FixedTag<u8, 16> db;
+    const FixedTag<U, K> d;
+
+    const zvec_svb_table<T> &t = zvec_svb_tables<T>();
+
+    Vec<decltype(d)> v0 = Set(d, (U)iv);
+    Vec<decltype(db)> v1;
+    const u8 *p = r + N / 4;
+    for (size_t i = 0; i < N; i += K) {
+        size_t c = sizeof(T) == 4 ? r[i >> 2] : (r[i >> 2] >> ((i & 2) << 1)) & 15;
+        v1 = TableLookupBytes(LoadU(db, p), Load(db, t.shuf[c]));
+        Store(Add(BitCast(d, v1), v0), d, (U*)x + i);
+        p += t.len[c];
+    }
+}
+
+#endif
+
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)(T * __restrict x, i24 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)<zvec_block_rel,T>(x, r, N, iv); }
@@ -1421,11 +2399,29 @@ template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, i24 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_rel,T>(x, r, N, iv); }
 template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)(T * __restrict x, i24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_mono,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for)(T * __restrict x, i24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for)(T * __restrict x, i24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)(T * __restrict x, i48 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)<zvec_block_rel,T>(x, r, N, iv); }
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, i48 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_rel,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)(T * __restrict x, i48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_mono,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for)(T * __restrict x, i48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for)(T * __restrict x, i48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_for,T>(x, r, N, iv); }
 
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)(T * __restrict x, u24 * __restrict r, size_t N, T iv)
@@ -1434,11 +2430,29 @@ template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, u24 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_rel,T>(x, r, N, iv); }
 template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)(T * __restrict x, u24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_mono,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for)(T * __restrict x, u24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,x24)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for)(T * __restrict x, u24 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x24)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)(T * __restrict x, u48 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)<zvec_block_rel,T>(x, r, N, iv); }
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)(T * __restrict x, u48 * __restrict r, size_t N, T iv)
 { ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_rel,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)(T * __restrict x, u48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_mono,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_encode_for)(T * __restrict x, u48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_encode,x48)<zvec_block_for,T>(x, r, N, iv); }
+template <typename T>
+void ZVEC_ARCH_FN1(zvec_ll_block_decode_for)(T * __restrict x, u48 * __restrict r, size_t N, T iv)
+{ ZVEC_ARCH_FN2(zvec_ll_block_decode,x48)<zvec_block_for,T>(x, r, N, iv); }
 
 template <typename T>
 void ZVEC_ARCH_FN1(zvec_ll_block_encode_abs)(T * __restrict x, i24 * __restrict r, size_t N)
@@ -1472,7 +2486,36 @@ void ZVEC_ARCH_FN1(zvec_ll_block_decode_abs)(T * __restrict x, u48 * __restrict
 #define zvec_ll_block_encode_rel ZVEC_ARCH_FN1(zvec_ll_block_encode_rel)
 #define zvec_ll_block_decode_abs ZVEC_ARCH_FN1(zvec_ll_block_decode_abs)
 #define zvec_ll_block_decode_rel ZVEC_ARCH_FN1(zvec_ll_block_decode_rel)
+#define zvec_ll_block_decode_mono ZVEC_ARCH_FN1(zvec_ll_block_decode_mono)
+#define zvec_ll_block_encode_for ZVEC_ARCH_FN1(zvec_ll_block_encode_for)
+#define zvec_ll_block_decode_for ZVEC_ARCH_FN1(zvec_ll_block_decode_for)
+#define zvec_ll_block_encode_abs_bits ZVEC_ARCH_FN1(zvec_ll_block_encode_abs_bits)
+#define zvec_ll_block_decode_abs_bits ZVEC_ARCH_FN1(zvec_ll_block_decode_abs_bits)
+#define zvec_ll_block_encode_rel_bits ZVEC_ARCH_FN1(zvec_ll_block_encode_rel_bits)
+#define zvec_ll_block_decode_rel_bits ZVEC_ARCH_FN1(zvec_ll_block_decode_rel_bits)
+#define zvec_ll_block_decode_mono_bits ZVEC_ARCH_FN1(zvec_ll_block_decode_mono_bits)
+#define zvec_ll_block_encode_for_bits ZVEC_ARCH_FN1(zvec_ll_block_encode_for_bits)
+#define zvec_ll_block_decode_for_bits ZVEC_ARCH_FN1(zvec_ll_block_decode_for_bits)
 #define zvec_ll_block_synth_abs ZVEC_ARCH_FN1(zvec_ll_block_synth_abs)
 #define zvec_ll_block_synth_rel ZVEC_ARCH_FN1(zvec_ll_block_synth_rel)
+#define zvec_ll_block_synth_add ZVEC_ARCH_FN1(zvec_ll_block_synth_add)
+#define zvec_ll_block_delta ZVEC_ARCH_FN1(zvec_ll_block_delta)
+#define zvec_ll_block_integrate ZVEC_ARCH_FN1(zvec_ll_block_integrate)
+#define zvec_ll_block_scale ZVEC_ARCH_FN1(zvec_ll_block_scale)
+#define zvec_ll_block_add ZVEC_ARCH_FN1(zvec_ll_block_add)
+#define zvec_ll_block_xor_delta ZVEC_ARCH_FN1(zvec_ll_block_xor_delta)
+#define zvec_ll_block_xor_prefix ZVEC_ARCH_FN1(zvec_ll_block_xor_prefix)
+#define zvec_ll_block_decode_decimal ZVEC_ARCH_FN1(zvec_ll_block_decode_decimal)
 #define zvec_ll_block_synth_both ZVEC_ARCH_FN1(zvec_ll_block_synth_both)
+#define zvec_ll_block_reduce ZVEC_ARCH_FN1(zvec_ll_block_reduce)
+#define zvec_ll_block_reduce_abs ZVEC_ARCH_FN1(zvec_ll_block_reduce_abs)
+#define zvec_ll_block_count ZVEC_ARCH_FN1(zvec_ll_block_count)
+#define zvec_ll_block_count_abs ZVEC_ARCH_FN1(zvec_ll_block_count_abs)
+#define zvec_ll_block_match ZVEC_ARCH_FN1(zvec_ll_block_match)
+#define zvec_ll_block_encode_ef ZVEC_ARCH_FN1(zvec_ll_block_encode_ef)
+#define zvec_ll_block_decode_ef ZVEC_ARCH_FN1(zvec_ll_block_decode_ef)
+#define zvec_ll_block_select_ef ZVEC_ARCH_FN1(zvec_ll_block_select_ef)
+#define zvec_ll_block_decode_rle ZVEC_ARCH_FN1(zvec_ll_block_decode_rle)
+#define zvec_ll_block_decode_dict ZVEC_ARCH_FN1(zvec_ll_block_decode_dict)
+#define zvec_ll_block_decode_svb ZVEC_ARCH_FN1(zvec_ll_block_decode_svb)
 
@@ -46,6 +46,12 @@ static zvec_op_types_i64 zvec_ops_i64;
 static zvec_op_types_u64 zvec_ops_u64;
 static zvec_op_types_i32 zvec_ops_i32;
 static zvec_op_types_u32 zvec_ops_u32;
+static zvec_op_types_i16 zvec_ops_i16;
+static zvec_op_types_u16 zvec_ops_u16;
+static zvec_op_types_i8 zvec_ops_i8;
+static zvec_op_types_u8 zvec_ops_u8;
+static zvec_op_types_f64 zvec_ops_f64;
+static zvec_op_types_f32 zvec_ops_f32;
 
 #define ZVEC_INIT_ARCH(arch) \
 static void ZVEC_FN2(zvec_init,arch)() { \
@@ -69,12 +75,56 @@ static void ZVEC_FN2(zvec_init,arch)() { \
     zvec_ops_i64.decode_rel_x24 = &ZVEC_FN2(zvec_ll_block_decode_rel_i64_i24,arch); \
     zvec_ops_i64.decode_rel_x32 = &ZVEC_FN2(zvec_ll_block_decode_rel_i64_i32,arch); \
     zvec_ops_i64.decode_rel_x48 = &ZVEC_FN2(zvec_ll_block_decode_rel_i64_i48,arch); \
+    zvec_ops_i64.decode_mono_x8 = &ZVEC_FN2(zvec_ll_block_decode_mono_i64_i8,arch); \
+    zvec_ops_i64.decode_mono_x16 = &ZVEC_FN2(zvec_ll_block_decode_mono_i64_i16,arch); \
+    zvec_ops_i64.decode_mono_x24 = &ZVEC_FN2(zvec_ll_block_decode_mono_i64_i24,arch); \
+    zvec_ops_i64.decode_mono_x32 = &ZVEC_FN2(zvec_ll_block_decode_mono_i64_i32,arch); \
+    zvec_ops_i64.decode_mono_x48 = &ZVEC_FN2(zvec_ll_block_decode_mono_i64_i48,arch); \
+    zvec_ops_i64.encode_for_x8 = &ZVEC_FN2(zvec_ll_block_encode_for_i64_i8,arch); \
+    zvec_ops_i64.encode_for_x16 = &ZVEC_FN2(zvec_ll_block_encode_for_i64_i16,arch); \
+    zvec_ops_i64.encode_for_x24 = &ZVEC_FN2(zvec_ll_block_encode_for_i64_i24,arch); \
+    zvec_ops_i64.encode_for_x32 = &ZVEC_FN2(zvec_ll_block_encode_for_i64_i32,arch); \
+    zvec_ops_i64.encode_for_x48 = &ZVEC_FN2(zvec_ll_block_encode_for_i64_i48,arch); \
+    zvec_ops_i64.decode_for_x8 = &ZVEC_FN2(zvec_ll_block_decode_for_i64_i8,arch); \
+    zvec_ops_i64.decode_for_x16 = &ZVEC_FN2(zvec_ll_block_decode_for_i64_i16,arch); \
+    zvec_ops_i64.decode_for_x24 = &ZVEC_FN2(zvec_ll_block_decode_for_i64_i24,arch); \
+    zvec_ops_i64.decode_for_x32 = &ZVEC_FN2(zvec_ll_block_decode_for_i64_i32,arch); \
+    zvec_ops_i64.decode_for_x48 = &ZVEC_FN2(zvec_ll_block_decode_for_i64_i48,arch); \
     zvec_ops_i64.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_i64,arch); \
     zvec_ops_i64.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_i64,arch); \
     zvec_ops_i64.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_i64,arch); \
     zvec_ops_i64.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_i64,arch); \
     zvec_ops_i64.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_i64,arch); \
+    zvec_ops_i64.synth_add = &ZVEC_FN2(zvec_ll_block_synth_add_i64,arch); \
+    zvec_ops_i64.delta = &ZVEC_FN2(zvec_ll_block_delta_i64,arch); \
+    zvec_ops_i64.integrate = &ZVEC_FN2(zvec_ll_block_integrate_i64,arch); \
+    zvec_ops_i64.scale = &ZVEC_FN2(zvec_ll_block_scale_i64,arch); \
+    zvec_ops_i64.add = &ZVEC_FN2(zvec_ll_block_add_i64,arch); \
+    zvec_ops_i64.xor_delta = &ZVEC_FN2(zvec_ll_block_xor_delta_i64,arch); \
+    zvec_ops_i64.xor_prefix = &ZVEC_FN2(zvec_ll_block_xor_prefix_i64,arch); \
     zvec_ops_i64.synth_both = &ZVEC_FN2(zvec_ll_block_synth_both_i64,arch); \
+    zvec_ops_i64.reduce_abs_x8 = &ZVEC_FN2(zvec_ll_block_reduce_abs_i64_i8,arch); \
+    zvec_ops_i64.reduce_abs_x16 = &ZVEC_FN2(zvec_ll_block_reduce_abs_i64_i16,arch); \
+    zvec_ops_i64.reduce_abs_x32 = &ZVEC_FN2(zvec_ll_block_reduce_abs_i64_i32,arch); \
+    zvec_ops_i64.count_abs_x8 = &ZVEC_FN2(zvec_ll_block_count_abs_i64_i8,arch); \
+    zvec_ops_i64.count_abs_x16 = &ZVEC_FN2(zvec_ll_block_count_abs_i64_i16,arch); \
+    zvec_ops_i64.count_abs_x32 = &ZVEC_FN2(zvec_ll_block_count_abs_i64_i32,arch); \
+    zvec_ops_i64.reduce = &ZVEC_FN2(zvec_ll_block_reduce_i64,arch); \
+    zvec_ops_i64.count = &ZVEC_FN2(zvec_ll_block_count_i64,arch); \
+    zvec_ops_i64.match = &ZVEC_FN2(zvec_ll_block_match_i64,arch); \
+    zvec_ops_i64.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_i64,arch); \
+    zvec_ops_i64.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_i64,arch); \
+    zvec_ops_i64.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_i64,arch); \
+    zvec_ops_i64.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_i64,arch); \
+    zvec_ops_i64.decode_mono_bits = &ZVEC_FN2(zvec_ll_block_decode_mono_bits_i64,arch); \
+    zvec_ops_i64.encode_for_bits = &ZVEC_FN2(zvec_ll_block_encode_for_bits_i64,arch); \
+    zvec_ops_i64.decode_for_bits = &ZVEC_FN2(zvec_ll_block_decode_for_bits_i64,arch); \
+    zvec_ops_i64.encode_ef = &ZVEC_FN2(zvec_ll_block_encode_ef_i64,arch); \
+    zvec_ops_i64.decode_ef = &ZVEC_FN2(zvec_ll_block_decode_ef_i64,arch); \
+    zvec_ops_i64.select_ef = &ZVEC_FN2(zvec_ll_block_select_ef_i64,arch); \
+    zvec_ops_i64.decode_rle = &ZVEC_FN2(zvec_ll_block_decode_rle_i64,arch); \
+    zvec_ops_i64.decode_dict = &ZVEC_FN2(zvec_ll_block_decode_dict_i64,arch); \
+    zvec_ops_i64.decode_svb = &ZVEC_FN2(zvec_ll_block_decode_svb_i64,arch); \
     zvec_ops_u64.encode_abs_x8 = &ZVEC_FN2(zvec_ll_block_encode_abs_u64_u8,arch); \
     zvec_ops_u64.encode_abs_x16 = &ZVEC_FN2(zvec_ll_block_encode_abs_u64_u16,arch); \
     zvec_ops_u64.encode_abs_x24 = &ZVEC_FN2(zvec_ll_block_encode_abs_u64_u24,arch); \
@@ -95,12 +145,56 @@ static void ZVEC_FN2(zvec_init,arch)() { \
     zvec_ops_u64.decode_rel_x24 = &ZVEC_FN2(zvec_ll_block_decode_rel_u64_u24,arch); \
     zvec_ops_u64.decode_rel_x32 = &ZVEC_FN2(zvec_ll_block_decode_rel_u64_u32,arch); \
     zvec_ops_u64.decode_rel_x48 = &ZVEC_FN2(zvec_ll_block_decode_rel_u64_u48,arch); \
+    zvec_ops_u64.decode_mono_x8 = &ZVEC_FN2(zvec_ll_block_decode_mono_u64_u8,arch); \
+    zvec_ops_u64.decode_mono_x16 = &ZVEC_FN2(zvec_ll_block_decode_mono_u64_u16,arch); \
+    zvec_ops_u64.decode_mono_x24 = &ZVEC_FN2(zvec_ll_block_decode_mono_u64_u24,arch); \
+    zvec_ops_u64.decode_mono_x32 = &ZVEC_FN2(zvec_ll_block_decode_mono_u64_u32,arch); \
+    zvec_ops_u64.decode_mono_x48 = &ZVEC_FN2(zvec_ll_block_decode_mono_u64_u48,arch); \
+    zvec_ops_u64.encode_for_x8 = &ZVEC_FN2(zvec_ll_block_encode_for_u64_u8,arch); \
+    zvec_ops_u64.encode_for_x16 = &ZVEC_FN2(zvec_ll_block_encode_for_u64_u16,arch); \
+    zvec_ops_u64.encode_for_x24 = &ZVEC_FN2(zvec_ll_block_encode_for_u64_u24,arch); \
+    zvec_ops_u64.encode_for_x32 = &ZVEC_FN2(zvec_ll_block_encode_for_u64_u32,arch); \
+    zvec_ops_u64.encode_for_x48 = &ZVEC_FN2(zvec_ll_block_encode_for_u64_u48,arch); \
+    zvec_ops_u64.decode_for_x8 = &ZVEC_FN2(zvec_ll_block_decode_for_u64_u8,arch); \
+    zvec_ops_u64.decode_for_x16 = &ZVEC_FN2(zvec_ll_block_decode_for_u64_u16,arch); \
+    zvec_ops_u64.decode_for_x24 = &ZVEC_FN2(zvec_ll_block_decode_for_u64_u24,arch); \
+    zvec_ops_u64.decode_for_x32 = &ZVEC_FN2(zvec_ll_block_decode_for_u64_u32,arch); \
+    zvec_ops_u64.decode_for_x48 = &ZVEC_FN2(zvec_ll_block_decode_for_u64_u48,arch); \
     zvec_ops_u64.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_u64,arch); \
     zvec_ops_u64.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_u64,arch); \
     zvec_ops_u64.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_u64,arch); \
     zvec_ops_u64.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_u64,arch); \
     zvec_ops_u64.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_u64,arch); \
+    zvec_ops_u64.synth_add = &ZVEC_FN2(zvec_ll_block_synth_add_u64,arch); \
+    zvec_ops_u64.delta = &ZVEC_FN2(zvec_ll_block_delta_u64,arch); \
+    zvec_ops_u64.integrate = &ZVEC_FN2(zvec_ll_block_integrate_u64,arch); \
+    zvec_ops_u64.scale = &ZVEC_FN2(zvec_ll_block_scale_u64,arch); \
+    zvec_ops_u64.add = &ZVEC_FN2(zvec_ll_block_add_u64,arch); \
+    zvec_ops_u64.xor_delta = &ZVEC_FN2(zvec_ll_block_xor_delta_u64,arch); \
+    zvec_ops_u64.xor_prefix = &ZVEC_FN2(zvec_ll_block_xor_prefix_u64,arch); \
     zvec_ops_u64.synth_both = &ZVEC_FN2(zvec_ll_block_synth_both_u64,arch); \
+    zvec_ops_u64.reduce_abs_x8 = &ZVEC_FN2(zvec_ll_block_reduce_abs_u64_u8,arch); \
+    zvec_ops_u64.reduce_abs_x16 = &ZVEC_FN2(zvec_ll_block_reduce_abs_u64_u16,arch); \
+    zvec_ops_u64.reduce_abs_x32 = &ZVEC_FN2(zvec_ll_block_reduce_abs_u64_u32,arch); \
+    zvec_ops_u64.count_abs_x8 = &ZVEC_FN2(zvec_ll_block_count_abs_u64_u8,arch); \
+    zvec_ops_u64.count_abs_x16 = &ZVEC_FN2(zvec_ll_block_count_abs_u64_u16,arch); \
+    zvec_ops_u64.count_abs_x32 = &ZVEC_FN2(zvec_ll_block_count_abs_u64_u32,arch); \
+    zvec_ops_u64.reduce = &ZVEC_FN2(zvec_ll_block_reduce_u64,arch); \
+    zvec_ops_u64.count = &ZVEC_FN2(zvec_ll_block_count_u64,arch); \
+    zvec_ops_u64.match = &ZVEC_FN2(zvec_ll_block_match_u64,arch); \
+    zvec_ops_u64.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_u64,arch); \
+    zvec_ops_u64.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_u64,arch); \
+    zvec_ops_u64.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_u64,arch); \
+    zvec_ops_u64.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_u64,arch); \
+    zvec_ops_u64.decode_mono_bits = &ZVEC_FN2(zvec_ll_block_decode_mono_bits_u64,arch); \
+    zvec_ops_u64.encode_for_bits = &ZVEC_FN2(zvec_ll_block_encode_for_bits_u64,arch); \
+    zvec_ops_u64.decode_for_bits = &ZVEC_FN2(zvec_ll_block_decode_for_bits_u64,arch); \
+    zvec_ops_u64.encode_ef = &ZVEC_FN2(zvec_ll_block_encode_ef_u64,arch); \
+    zvec_ops_u64.decode_ef = &ZVEC_FN2(zvec_ll_block_decode_ef_u64,arch); \
+    zvec_ops_u64.select_ef = &ZVEC_FN2(zvec_ll_block_select_ef_u64,arch); \
+    zvec_ops_u64.decode_rle = &ZVEC_FN2(zvec_ll_block_decode_rle_u64,arch); \
+    zvec_ops_u64.decode_dict = &ZVEC_FN2(zvec_ll_block_decode_dict_u64,arch); \
+    zvec_ops_u64.decode_svb = &ZVEC_FN2(zvec_ll_block_decode_svb_u64,arch); \
     zvec_ops_i32.encode_abs_x8 = &ZVEC_FN2(zvec_ll_block_encode_abs_i32_i8,arch); \
     zvec_ops_i32.encode_abs_x16 = &ZVEC_FN2(zvec_ll_block_encode_abs_i32_i16,arch); \
     zvec_ops_i32.encode_abs_x24 = &ZVEC_FN2(zvec_ll_block_encode_abs_i32_i24,arch); \
@@ -113,12 +207,48 @@ static void ZVEC_FN2(zvec_init,arch)() { \
     zvec_ops_i32.decode_rel_x8 = &ZVEC_FN2(zvec_ll_block_decode_rel_i32_i8,arch); \
     zvec_ops_i32.decode_rel_x16 = &ZVEC_FN2(zvec_ll_block_decode_rel_i32_i16,arch); \
     zvec_ops_i32.decode_rel_x24 = &ZVEC_FN2(zvec_ll_block_decode_rel_i32_i24,arch); \
+    zvec_ops_i32.decode_mono_x8 = &ZVEC_FN2(zvec_ll_block_decode_mono_i32_i8,arch); \
+    zvec_ops_i32.decode_mono_x16 = &ZVEC_FN2(zvec_ll_block_decode_mono_i32_i16,arch); \
+    zvec_ops_i32.decode_mono_x24 = &ZVEC_FN2(zvec_ll_block_decode_mono_i32_i24,arch); \
+    zvec_ops_i32.encode_for_x8 = &ZVEC_FN2(zvec_ll_block_encode_for_i32_i8,arch); \
+    zvec_ops_i32.encode_for_x16 = &ZVEC_FN2(zvec_ll_block_encode_for_i32_i16,arch); \
+    zvec_ops_i32.encode_for_x24 = &ZVEC_FN2(zvec_ll_block_encode_for_i32_i24,arch); \
+    zvec_ops_i32.decode_for_x8 = &ZVEC_FN2(zvec_ll_block_decode_for_i32_i8,arch); \
+    zvec_ops_i32.decode_for_x16 = &ZVEC_FN2(zvec_ll_block_decode_for_i32_i16,arch); \
+    zvec_ops_i32.decode_for_x24 = &ZVEC_FN2(zvec_ll_block_decode_for_i32_i24,arch); \
     zvec_ops_i32.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_i32,arch); \
     zvec_ops_i32.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_i32,arch); \
     zvec_ops_i32.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_i32,arch); \
     zvec_ops_i32.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_i32,arch); \
     zvec_ops_i32.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_i32,arch); \
+    zvec_ops_i32.synth_add = &ZVEC_FN2(zvec_ll_block_synth_add_i32,arch); \
+    zvec_ops_i32.delta = &ZVEC_FN2(zvec_ll_block_delta_i32,arch); \
+    zvec_ops_i32.integrate = &ZVEC_FN2(zvec_ll_block_integrate_i32,arch); \
+    zvec_ops_i32.scale = &ZVEC_FN2(zvec_ll_block_scale_i32,arch); \
+    zvec_ops_i32.add = &ZVEC_FN2(zvec_ll_block_add_i32,arch); \
+    zvec_ops_i32.xor_delta = &ZVEC_FN2(zvec_ll_block_xor_delta_i32,arch); \
+    zvec_ops_i32.xor_prefix = &ZVEC_FN2(zvec_ll_block_xor_prefix_i32,arch); \
     zvec_ops_i32.synth_both = &ZVEC_FN2(zvec_ll_block_synth_both_i32,arch); \
+    zvec_ops_i32.reduce_abs_x8 = &ZVEC_FN2(zvec_ll_block_reduce_abs_i32_i8,arch); \
+    zvec_ops_i32.reduce_abs_x16 = &ZVEC_FN2(zvec_ll_block_reduce_abs_i32_i16,arch); \
+    zvec_ops_i32.count_abs_x8 = &ZVEC_FN2(zvec_ll_block_count_abs_i32_i8,arch); \
+    zvec_ops_i32.count_abs_x16 = &ZVEC_FN2(zvec_ll_block_count_abs_i32_i16,arch); \
+    zvec_ops_i32.reduce = &ZVEC_FN2(zvec_ll_block_reduce_i32,arch); \
+    zvec_ops_i32.count = &ZVEC_FN2(zvec_ll_block_count_i32,arch); \
+    zvec_ops_i32.match = &ZVEC_FN2(zvec_ll_block_match_i32,arch); \
+    zvec_ops_i32.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_i32,arch); \
+    zvec_ops_i32.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_i32,arch); \
+    zvec_ops_i32.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_i32,arch); \
+    zvec_ops_i32.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_i32,arch); \
+    zvec_ops_i32.decode_mono_bits = &ZVEC_FN2(zvec_ll_block_decode_mono_bits_i32,arch); \
+    zvec_ops_i32.encode_for_bits = &ZVEC_FN2(zvec_ll_block_encode_for_bits_i32,arch); \
+    zvec_ops_i32.decode_for_bits = &ZVEC_FN2(zvec_ll_block_decode_for_bits_i32,arch); \
+    zvec_ops_i32.encode_ef = &ZVEC_FN2(zvec_ll_block_encode_ef_i32,arch); \
+    zvec_ops_i32.decode_ef = &ZVEC_FN2(zvec_ll_block_decode_ef_i32,arch); \
+    zvec_ops_i32.select_ef = &ZVEC_FN2(zvec_ll_block_select_ef_i32,arch); \
+    zvec_ops_i32.decode_rle = &ZVEC_FN2(zvec_ll_block_decode_rle_i32,arch); \
+    zvec_ops_i32.decode_dict = &ZVEC_FN2(zvec_ll_block_decode_dict_i32,arch); \
+    zvec_ops_i32.decode_svb = &ZVEC_FN2(zvec_ll_block_decode_svb_i32,arch); \
     zvec_ops_u32.encode_abs_x8 = &ZVEC_FN2(zvec_ll_block_encode_abs_u32_u8,arch); \
     zvec_ops_u32.encode_abs_x16 = &ZVEC_FN2(zvec_ll_block_encode_abs_u32_u16,arch); \
     zvec_ops_u32.encode_abs_x24 = &ZVEC_FN2(zvec_ll_block_encode_abs_u32_u24,arch); \
@@ -131,12 +261,112 @@ static void ZVEC_FN2(zvec_init,arch)() { \
     zvec_ops_u32.decode_rel_x8 = &ZVEC_FN2(zvec_ll_block_decode_rel_u32_u8,arch); \
     zvec_ops_u32.decode_rel_x16 = &ZVEC_FN2(zvec_ll_block_decode_rel_u32_u16,arch); \
     zvec_ops_u32.decode_rel_x24 = &ZVEC_FN2(zvec_ll_block_decode_rel_u32_u24,arch); \
+    zvec_ops_u32.decode_mono_x8 = &ZVEC_FN2(zvec_ll_block_decode_mono_u32_u8,arch); \
+    zvec_ops_u32.decode_mono_x16 = &ZVEC_FN2(zvec_ll_block_decode_mono_u32_u16,arch); \
+    zvec_ops_u32.decode_mono_x24 = &ZVEC_FN2(zvec_ll_block_decode_mono_u32_u24,arch); \
+    zvec_ops_u32.encode_for_x8 = &ZVEC_FN2(zvec_ll_block_encode_for_u32_u8,arch); \
+    zvec_ops_u32.encode_for_x16 = &ZVEC_FN2(zvec_ll_block_encode_for_u32_u16,arch); \
+    zvec_ops_u32.encode_for_x24 = &ZVEC_FN2(zvec_ll_block_encode_for_u32_u24,arch); \
+    zvec_ops_u32.decode_for_x8 = &ZVEC_FN2(zvec_ll_block_decode_for_u32_u8,arch); \
+    zvec_ops_u32.decode_for_x16 = &ZVEC_FN2(zvec_ll_block_decode_for_u32_u16,arch); \
+    zvec_ops_u32.decode_for_x24 = &ZVEC_FN2(zvec_ll_block_decode_for_u32_u24,arch); \
     zvec_ops_u32.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_u32,arch); \
     zvec_ops_u32.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_u32,arch); \
     zvec_ops_u32.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_u32,arch); \
     zvec_ops_u32.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_u32,arch); \
     zvec_ops_u32.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_u32,arch); \
+    zvec_ops_u32.synth_add = &ZVEC_FN2(zvec_ll_block_synth_add_u32,arch); \
+    zvec_ops_u32.delta = &ZVEC_FN2(zvec_ll_block_delta_u32,arch); \
+    zvec_ops_u32.integrate = &ZVEC_FN2(zvec_ll_block_integrate_u32,arch); \
+    zvec_ops_u32.scale = &ZVEC_FN2(zvec_ll_block_scale_u32,arch); \
+    zvec_ops_u32.add = &ZVEC_FN2(zvec_ll_block_add_u32,arch); \
+    zvec_ops_u32.xor_delta = &ZVEC_FN2(zvec_ll_block_xor_delta_u32,arch); \
+    zvec_ops_u32.xor_prefix = &ZVEC_FN2(zvec_ll_block_xor_prefix_u32,arch); \
     zvec_ops_u32.synth_both = &ZVEC_FN2(zvec_ll_block_synth_both_u32,arch); \
+    zvec_ops_u32.reduce_abs_x8 = &ZVEC_FN2(zvec_ll_block_reduce_abs_u32_u8,arch); \
+    zvec_ops_u32.reduce_abs_x16 = &ZVEC_FN2(zvec_ll_block_reduce_abs_u32_u16,arch); \
+    zvec_ops_u32.count_abs_x8 = &ZVEC_FN2(zvec_ll_block_count_abs_u32_u8,arch); \
+    zvec_ops_u32.count_abs_x16 = &ZVEC_FN2(zvec_ll_block_count_abs_u32_u16,arch); \
+    zvec_ops_u32.reduce = &ZVEC_FN2(zvec_ll_block_reduce_u32,arch); \
+    zvec_ops_u32.count = &ZVEC_FN2(zvec_ll_block_count_u32,arch); \
+    zvec_ops_u32.match = &ZVEC_FN2(zvec_ll_block_match_u32,arch); \
+    zvec_ops_u32.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_u32,arch); \
+    zvec_ops_u32.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_u32,arch); \
+    zvec_ops_u32.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_u32,arch); \
+    zvec_ops_u32.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_u32,arch); \
+    zvec_ops_u32.decode_mono_bits = &ZVEC_FN2(zvec_ll_block_decode_mono_bits_u32,arch); \
+    zvec_ops_u32.encode_for_bits = &ZVEC_FN2(zvec_ll_block_encode_for_bits_u32,arch); \
+    zvec_ops_u32.decode_for_bits = &ZVEC_FN2(zvec_ll_block_decode_for_bits_u32,arch); \
+    zvec_ops_u32.encode_ef = &ZVEC_FN2(zvec_ll_block_encode_ef_u32,arch); \
+    zvec_ops_u32.decode_ef = &ZVEC_FN2(zvec_ll_block_decode_ef_u32,arch); \
+    zvec_ops_u32.select_ef = &ZVEC_FN2(zvec_ll_block_select_ef_u32,arch); \
+    zvec_ops_u32.decode_rle = &ZVEC_FN2(zvec_ll_block_decode_rle_u32,arch); \
+    zvec_ops_u32.decode_dict = &ZVEC_FN2(zvec_ll_block_decode_dict_u32,arch); \
+    zvec_ops_u32.decode_svb = &ZVEC_FN2(zvec_ll_block_decode_svb_u32,arch); \
+    zvec_ops_i16.encode_abs_x8 = &ZVEC_FN2(zvec_ll_block_encode_abs_i16_i8,arch); \
+    zvec_ops_i16.decode_abs_x8 = &ZVEC_FN2(zvec_ll_block_decode_abs_i16_i8,arch); \
+    zvec_ops_i16.encode_rel_x8 = &ZVEC_FN2(zvec_ll_block_encode_rel_i16_i8,arch); \
+    zvec_ops_i16.decode_rel_x8 = &ZVEC_FN2(zvec_ll_block_decode_rel_i16_i8,arch); \
+    zvec_ops_i16.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_i16,arch); \
+    zvec_ops_i16.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_i16,arch); \
+    zvec_ops_i16.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_i16,arch); \
+    zvec_ops_i16.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_i16,arch); \
+    zvec_ops_i16.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_i16,arch); \
+    zvec_ops_i16.reduce = &ZVEC_FN2(zvec_ll_block_reduce_i16,arch); \
+    zvec_ops_i16.count = &ZVEC_FN2(zvec_ll_block_count_i16,arch); \
+    zvec_ops_i16.match = &ZVEC_FN2(zvec_ll_block_match_i16,arch); \
+    zvec_ops_i16.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_i16,arch); \
+    zvec_ops_i16.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_i16,arch); \
+    zvec_ops_i16.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_i16,arch); \
+    zvec_ops_i16.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_i16,arch); \
+    zvec_ops_u16.encode_abs_x8 = &ZVEC_FN2(zvec_ll_block_encode_abs_u16_u8,arch); \
+    zvec_ops_u16.decode_abs_x8 = &ZVEC_FN2(zvec_ll_block_decode_abs_u16_u8,arch); \
+    zvec_ops_u16.encode_rel_x8 = &ZVEC_FN2(zvec_ll_block_encode_rel_u16_u8,arch); \
+    zvec_ops_u16.decode_rel_x8 = &ZVEC_FN2(zvec_ll_block_decode_rel_u16_u8,arch); \
+    zvec_ops_u16.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_u16,arch); \
+    zvec_ops_u16.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_u16,arch); \
+    zvec_ops_u16.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_u16,arch); \
+    zvec_ops_u16.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_u16,arch); \
+    zvec_ops_u16.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_u16,arch); \
+    zvec_ops_u16.reduce = &ZVEC_FN2(zvec_ll_block_reduce_u16,arch); \
+    zvec_ops_u16.count = &ZVEC_FN2(zvec_ll_block_count_u16,arch); \
+    zvec_ops_u16.match = &ZVEC_FN2(zvec_ll_block_match_u16,arch); \
+    zvec_ops_u16.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_u16,arch); \
+    zvec_ops_u16.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_u16,arch); \
+    zvec_ops_u16.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_u16,arch); \
+    zvec_ops_u16.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_u16,arch); \
+    zvec_ops_i8.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_i8,arch); \
+    zvec_ops_i8.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_i8,arch); \
+    zvec_ops_i8.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_i8,arch); \
+    zvec_ops_i8.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_i8,arch); \
+    zvec_ops_i8.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_i8,arch); \
+    zvec_ops_i8.reduce = &ZVEC_FN2(zvec_ll_block_reduce_i8,arch); \
+    zvec_ops_i8.count = &ZVEC_FN2(zvec_ll_block_count_i8,arch); \
+    zvec_ops_i8.match = &ZVEC_FN2(zvec_ll_block_match_i8,arch); \
+    zvec_ops_i8.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_i8,arch); \
+    zvec_ops_i8.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_i8,arch); \
+    zvec_ops_i8.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_i8,arch); \
+    zvec_ops_i8.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_i8,arch); \
+    zvec_ops_u8.scan_abs = &ZVEC_FN2(zvec_ll_block_scan_abs_u8,arch); \
+    zvec_ops_u8.scan_rel = &ZVEC_FN2(zvec_ll_block_scan_rel_u8,arch); \
+    zvec_ops_u8.scan_both = &ZVEC_FN2(zvec_ll_block_scan_both_u8,arch); \
+    zvec_ops_u8.synth_abs = &ZVEC_FN2(zvec_ll_block_synth_abs_u8,arch); \
+    zvec_ops_u8.synth_rel = &ZVEC_FN2(zvec_ll_block_synth_rel_u8,arch); \
+    zvec_ops_u8.reduce = &ZVEC_FN2(zvec_ll_block_reduce_u8,arch); \
+    zvec_ops_u8.count = &ZVEC_FN2(zvec_ll_block_count_u8,arch); \
+    zvec_ops_u8.match = &ZVEC_FN2(zvec_ll_block_match_u8,arch); \
+    zvec_ops_u8.encode_abs_bits = &ZVEC_FN2(zvec_ll_block_encode_abs_bits_u8,arch); \
+    zvec_ops_u8.decode_abs_bits = &ZVEC_FN2(zvec_ll_block_decode_abs_bits_u8,arch); \
+    zvec_ops_u8.encode_rel_bits = &ZVEC_FN2(zvec_ll_block_encode_rel_bits_u8,arch); \
+    zvec_ops_u8.decode_rel_bits = &ZVEC_FN2(zvec_ll_block_decode_rel_bits_u8,arch); \
+    zvec_ops_f64.reduce = &ZVEC_FN2(zvec_ll_block_reduce_f64,arch); \
+    zvec_ops_f64.count = &ZVEC_FN2(zvec_ll_block_count_f64,arch); \
+    zvec_ops_f64.match = &ZVEC_FN2(zvec_ll_block_match_f64,arch); \
+    zvec_ops_f64.decode_decimal = &ZVEC_FN2(zvec_ll_block_decode_decimal_f64,arch); \
+    zvec_ops_f32.reduce = &ZVEC_FN2(zvec_ll_block_reduce_f32,arch); \
+    zvec_ops_f32.count = &ZVEC_FN2(zvec_ll_block_count_f32,arch); \
+    zvec_ops_f32.match = &ZVEC_FN2(zvec_ll_block_match_f32,arch); \
+    zvec_ops_f32.decode_decimal = &ZVEC_FN2(zvec_ll_block_decode_decimal_f32,arch); \
 }
 
 static zvec_arch override_arch = zvec_arch_unspecified;
@@ -217,4 +447,40 @@ zvec_op_types_u32* get_zvec_ops_u32()
 {
     if (zvec_ops_u32.synth_rel == nullptr) zvec_init();
     return &zvec_ops_u32;
-}
\ No newline at end of file
+}
+
+zvec_op_types_i16* get_zvec_ops_i16()
+{
+    if (zvec_ops_i16.synth_rel == nullptr) zvec_init();
+    return &zvec_ops_i16;
+}
+
+zvec_op_types_u16* get_zvec_ops_u16()
+{
+    if (zvec_ops_u16.synth_rel == nullptr) zvec_init();
+    return &zvec_ops_u16;
+}
+
+zvec_op_types_i8* get_zvec_ops_i8()
+{
+    if (zvec_ops_i8.synth_rel == nullptr) zvec_init();
+    return &zvec_ops_i8;
+}
+
+zvec_op_types_u8* get_zvec_ops_u8()
+{
+    if (zvec_ops_u8.synth_rel == nullptr) zvec_init();
+    return &zvec_ops_u8;
+}
+
+zvec_op_types_f64* get_zvec_ops_f64()
+{
+    if (zvec_ops_f64.reduce == nullptr) zvec_init();
+    return &zvec_ops_f64;
+}
+
+zvec_op_types_f32* get_zvec_ops_f32()
+{
+    if (zvec_ops_f32.reduce == nullptr) zvec_init();
+    return &zvec_ops_f32;
+}
@@ -38,12 +38,56 @@ struct zvec_op_types_64
     void (*decode_rel_x24)(T *x, X24 *r, size_t n, T iv);
     void (*decode_rel_x32)(T *x, X32 *r, size_t n, T iv);
     void (*decode_rel_x48)(T *x, X48 *r, size_t n, T iv);
+    void (*decode_mono_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*decode_mono_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*decode_mono_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*decode_mono_x32)(T *x, X32 *r, size_t n, T iv);
+    void (*decode_mono_x48)(T *x, X48 *r, size_t n, T iv);
+    void (*encode_for_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*encode_for_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*encode_for_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*encode_for_x32)(T *x, X32 *r, size_t n, T iv);
+    void (*encode_for_x48)(T *x, X48 *r, size_t n, T iv);
+    void (*decode_for_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*decode_for_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*decode_for_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*decode_for_x32)(T *x, X32 *r, size_t n, T iv);
+    void (*decode_for_x48)(T *x, X48 *r, size_t n, T iv);
     zvec_stats<T> (*scan_abs)(T *x, size_t n);
     zvec_stats<T> (*scan_rel)(T *x, size_t n);
     zvec_stats<T> (*scan_both)(T *x, size_t n);
     void (*synth_abs)(T *x, size_t n, T iv);
     void (*synth_rel)(T *x, size_t n, T iv, T dv);
+    void (*synth_add)(T *x, size_t n, T iv, T dv);
+    void (*delta)(T *x, T *y, size_t n, T iv);
+    void (*integrate)(T *x, size_t n, T iv);
+    void (*scale)(T *x, size_t n, T iv, T g);
+    void (*add)(T *x, T *y, size_t n);
+    void (*xor_delta)(T *x, T *y, size_t n, T iv, int s);
+    void (*xor_prefix)(T *x, size_t n, T iv, int s);
     void (*synth_both)(T *x, size_t n, T iv, T dv);
+    zvec_aggr<T> (*reduce_abs_x8)(X8 *r, size_t n);
+    zvec_aggr<T> (*reduce_abs_x16)(X16 *r, size_t n);
+    zvec_aggr<T> (*reduce_abs_x32)(X32 *r, size_t n);
+    size_t (*count_abs_x8)(X8 *r, size_t n, X8 lo, X8 hi);
+    size_t (*count_abs_x16)(X16 *r, size_t n, X16 lo, X16 hi);
+    size_t (*count_abs_x32)(X32 *r, size_t n, X32 lo, X32 hi);
+    zvec_aggr<T> (*reduce)(T *x, size_t n);
+    size_t (*count)(T *x, size_t n, T lo, T hi);
+    size_t (*match)(T *x, size_t n, T lo, T hi, u64 *bits);
+    void (*encode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*decode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*encode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_mono_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*encode_for_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_for_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*encode_ef)(T *x, u64 *r, size_t n, T iv, int l);
+    void (*decode_ef)(T *x, u64 *r, size_t n, T iv, int l);
+    T (*select_ef)(u64 *r, size_t n, T iv, int l, size_t k);
+    void (*decode_rle)(T *x, T *v, u16 *e, size_t r);
+    void (*decode_dict)(T *x, T *t, size_t n);
+    void (*decode_svb)(T *x, u8 *r, size_t n, T iv);
 };
 
 template<typename T, typename X24, typename X16, typename X8>
@@ -61,18 +105,107 @@ struct zvec_op_types_32
     void (*decode_rel_x8)(T *x, X8 *r, size_t n, T iv);
     void (*decode_rel_x16)(T *x, X16 *r, size_t n, T iv);
     void (*decode_rel_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*decode_mono_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*decode_mono_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*decode_mono_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*encode_for_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*encode_for_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*encode_for_x24)(T *x, X24 *r, size_t n, T iv);
+    void (*decode_for_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*decode_for_x16)(T *x, X16 *r, size_t n, T iv);
+    void (*decode_for_x24)(T *x, X24 *r, size_t n, T iv);
     zvec_stats<T> (*scan_abs)(T *x, size_t n);
     zvec_stats<T> (*scan_rel)(T *x, size_t n);
     zvec_stats<T> (*scan_both)(T *x, size_t n);
     void (*synth_abs)(T *x, size_t n, T iv);
     void (*synth_rel)(T *x, size_t n, T iv, T dv);
+    void (*synth_add)(T *x, size_t n, T iv, T dv);
+    void (*delta)(T *x, T *y, size_t n, T iv);
+    void (*integrate)(T *x, size_t n, T iv);
+    void (*scale)(T *x, size_t n, T iv, T g);
+    void (*add)(T *x, T *y, size_t n);
+    void (*xor_delta)(T *x, T *y, size_t n, T iv, int s);
+    void (*xor_prefix)(T *x, size_t n, T iv, int s);
     void (*synth_both)(T *x, size_t n, T iv, T dv);
+    zvec_aggr<T> (*reduce_abs_x8)(X8 *r, size_t n);
+    zvec_aggr<T> (*reduce_abs_x16)(X16 *r, size_t n);
+    size_t (*count_abs_x8)(X8 *r, size_t n, X8 lo, X8 hi);
+    size_t (*count_abs_x16)(X16 *r, size_t n, X16 lo, X16 hi);
+    zvec_aggr<T> (*reduce)(T *x, size_t n);
+    size_t (*count)(T *x, size_t n, T lo, T hi);
+    size_t (*match)(T *x, size_t n, T lo, T hi, u64 *bits);
+    void (*encode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*decode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*encode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_mono_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*encode_for_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_for_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*encode_ef)(T *x, u64 *r, size_t n, T iv, int l);
+    void (*decode_ef)(T *x, u64 *r, size_t n, T iv, int l);
+    T (*select_ef)(u64 *r, size_t n, T iv, int l, size_t k);
+    void (*decode_rle)(T *x, T *v, u16 *e, size_t r);
+    void (*decode_dict)(T *x, T *t, size_t n);
+    void (*decode_svb)(T *x, u8 *r, size_t n, T iv);
+};
+
+template<typename T, typename X8>
+struct zvec_op_types_16
+{
+    void (*encode_abs_x8)(T *x, X8 *r, size_t n);
+    void (*decode_abs_x8)(T *x, X8 *r, size_t n);
+    void (*encode_rel_x8)(T *x, X8 *r, size_t n, T iv);
+    void (*decode_rel_x8)(T *x, X8 *r, size_t n, T iv);
+    zvec_stats<T> (*scan_abs)(T *x, size_t n);
+    zvec_stats<T> (*scan_rel)(T *x, size_t n);
+    zvec_stats<T> (*scan_both)(T *x, size_t n);
+    void (*synth_abs)(T *x, size_t n, T iv);
+    void (*synth_rel)(T *x, size_t n, T iv, T dv);
+    zvec_aggr<T> (*reduce)(T *x, size_t n);
+    size_t (*count)(T *x, size_t n, T lo, T hi);
+    size_t (*match)(T *x, size_t n, T lo, T hi, u64 *bits);
+    void (*encode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*decode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*encode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+};
+
+template<typename T>
+struct zvec_op_types_8
+{
+    zvec_stats<T> (*scan_abs)(T *x, size_t n);
+    zvec_stats<T> (*scan_rel)(T *x, size_t n);
+    zvec_stats<T> (*scan_both)(T *x, size_t n);
+    void (*synth_abs)(T *x, size_t n, T iv);
+    void (*synth_rel)(T *x, size_t n, T iv, T dv);
+    zvec_aggr<T> (*reduce)(T *x, size_t n);
+    size_t (*count)(T *x, size_t n, T lo, T hi);
+    size_t (*match)(T *x, size_t n, T lo, T hi, u64 *bits);
+    void (*encode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*decode_abs_bits)(T *x, u64 *r, size_t n, int b);
+    void (*encode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+    void (*decode_rel_bits)(T *x, u64 *r, size_t n, T iv, int b);
+};
+
+template<typename T>
+struct zvec_op_types_fp
+{
+    zvec_aggr<T> (*reduce)(T *x, size_t n);
+    size_t (*count)(T *x, size_t n, T lo, T hi);
+    size_t (*match)(T *x, size_t n, T lo, T hi, u64 *bits);
+    void (*decode_decimal)(T *x, size_t n, T p);
 };
 
 using zvec_op_types_i64 = zvec_op_types_64<i64,i48,i32,i24,i16,i8>;
 using zvec_op_types_u64 = zvec_op_types_64<u64,u48,u32,u24,u16,u8>;
 using zvec_op_types_i32 = zvec_op_types_32<i32,i24,i16,i8>;
 using zvec_op_types_u32 = zvec_op_types_32<u32,u24,u16,u8>;
+using zvec_op_types_i16 = zvec_op_types_16<i16,i8>;
+using zvec_op_types_u16 = zvec_op_types_16<u16,u8>;
+using zvec_op_types_i8 = zvec_op_types_8<i8>;
+using zvec_op_types_u8 = zvec_op_types_8<u8>;
+using zvec_op_types_f64 = zvec_op_types_fp<f64>;
+using zvec_op_types_f32 = zvec_op_types_fp<f32>;
 
 enum zvec_arch {
     zvec_arch_unspecified,
@@ -86,3 +219,9 @@ zvec_op_types_i64* get_zvec_ops_i64();
 zvec_op_types_u64* get_zvec_ops_u64();
 zvec_op_types_i32* get_zvec_ops_i32();
 zvec_op_types_u32* get_zvec_ops_u32();
+zvec_op_types_i16* get_zvec_ops_i16();
+zvec_op_types_u16* get_zvec_ops_u16();
+zvec_op_types_i8* get_zvec_ops_i8();
+zvec_op_types_u8* get_zvec_ops_u8();
+zvec_op_types_f64* get_zvec_ops_f64();
+zvec_op_types_f32* get_zvec_ops_f32();
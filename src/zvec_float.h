@@ -0,0 +1,370 @@
+/*
+ * PLEASE LICENSE 2022, Michael Clark <michaeljclark@mac.com>
+ *
+ * All rights to this work are granted for all purposes, with exception of
+ * author's implied right of copyright to defend the free use of this work.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <cmath>
+
+/*
+ * floating point blocks are encoded with the integer width kernels, either
+ * on their bit patterns or on scaled integers. encoding is lossless for all
+ * bit patterns including signed zeros, infinities and NaN.
+ *
+ * - constant blocks where every element has the same bit pattern.
+ *
+ * - xor blocks hold the bit pattern of each element xor its predecessor,
+ *   with trailing zero bits common to the block shifted out and leading
+ *   zero bits trimmed by the frame of reference width. the page index holds
+ *   the first element in iv and the shift in dv. neighbouring values that
+ *   share a sign and exponent share their high bits so slowly drifting
+ *   series pack narrow.
+ *
+ * - decimal blocks hold integers m where m / 10^k reproduces the element
+ *   exactly, as frame of reference offsets from the smallest m. the page
+ *   index holds the smallest m in iv and k in dv. prices and metrics with
+ *   few decimal places such as 12.34 pack to the width of 1234.
+ *
+ * blocks that do not compress are stored in place as absolute blocks.
+ */
+
+template <typename F> struct zvec_float_traits;
+
+template <> struct zvec_float_traits<f64>
+{
+    typedef u64 U;
+    typedef i64 I;
+    enum { max_exp = 15, mant_bits = 53 };
+};
+
+template <> struct zvec_float_traits<f32>
+{
+    typedef u32 U;
+    typedef i32 I;
+    enum { max_exp = 7, mant_bits = 24 };
+};
+
+static const f64 zvec_pow10[16] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+};
+
+template <typename F>
+typename zvec_float_traits<F>::U zvec_float_bits(F x)
+{
+    typename zvec_float_traits<F>::U u;
+    memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+template <typename F>
+struct zvec_float_stats
+{
+    using I = typename zvec_float_traits<F>::I;
+    zvec_codec codec;
+    F iv;
+    F dmin;
+    F dmax;
+    F amin;
+    F amax;
+    u8 xsize;
+    u8 xshift;
+    u8 msize;
+    u8 mexp;
+    I mmin;
+};
+
+template <> struct zvec_stats<f64> : zvec_float_stats<f64> {};
+template <> struct zvec_stats<f32> : zvec_float_stats<f32> {};
+
+/* scaled integer for x with k decimal places, true if it reproduces x */
+
+template <typename F>
+bool zvec_float_decimal(F x, int k, typename zvec_float_traits<F>::I &m)
+{
+    typedef typename zvec_float_traits<F>::I I;
+    F y = x * (F)zvec_pow10[k];
+    if (!(std::fabs(y) < (F)(1ull << zvec_float_traits<F>::mant_bits))) return false;
+    m = (I)std::llrint(y);
+    return zvec_float_bits((F)m / (F)zvec_pow10[k]) == zvec_float_bits(x);
+}
+
+/*
+ * scan floating point block. min and max skip NaN. the xor width comes
+ * from the union of the xor words and the decimal exponent is raised
+ * until every element round trips, which holds for larger exponents.
+ */
+
+template <typename F>
+zvec_stats<F> zvec_float_scan(F * __restrict x, size_t n, zvec_codec codec)
+{
+    typedef typename zvec_float_traits<F>::U U;
+    typedef typename zvec_float_traits<F>::I I;
+
+    zvec_stats<F> s = {};
+    s.codec = codec;
+    s.iv = x[0];
+    s.amin = s.dmin = zvec_highest<F>();
+    s.amax = s.dmax = zvec_lowest<F>();
+
+    U p = zvec_float_bits(x[0]), w = 0;
+    for (size_t i = 0; i < n; i++) {
+        U b = zvec_float_bits(x[i]);
+        w |= b ^ p;
+        p = b;
+        s.amin = std::min(s.amin, x[i]);
+        s.amax = std::max(s.amax, x[i]);
+        if (i > 0) {
+            F d = x[i] - x[i - 1];
+            s.dmin = std::min(s.dmin, d);
+            s.dmax = std::max(s.dmax, d);
+        }
+    }
+    if (w == 0) return s;
+
+    zvec_stats<U> t = {};
+    s.xshift = (u8)(sizeof(U) == 8 ? ctz_u64(w) : ctz_u32((u32)w));
+    t.amax = w >> s.xshift;
+    s.xsize = (u8)zvec_size_for(t);
+
+    int k = 0;
+    I m = 0;
+    for (size_t i = 0; i < n && k <= zvec_float_traits<F>::max_exp; i++) {
+        while (k <= zvec_float_traits<F>::max_exp && !zvec_float_decimal(x[i], k, m)) k++;
+    }
+    if (k <= zvec_float_traits<F>::max_exp) {
+        zvec_stats<I> r = {};
+        r.amin = std::numeric_limits<I>::max();
+        r.amax = std::numeric_limits<I>::min();
+        for (size_t i = 0; i < n; i++) {
+            zvec_float_decimal(x[i], k, m);
+            r.amin = std::min(r.amin, m);
+            r.amax = std::max(r.amax, m);
+        }
+        s.msize = (u8)zvec_size_for(r);
+        s.mexp = (u8)k;
+        s.mmin = r.amin;
+    }
+    return s;
+}
+
+/* ties prefer decimal blocks which can read one element without decoding */
+
+template <typename F>
+zvec_format zvec_float_format(zvec_stats<F> s)
+{
+    constexpr zvec_size max_size = sizeof(F) == 8 ? zvec_size_64 : zvec_size_32;
+    if (s.xsize == zvec_size_0) {
+        return zvec_format { (u8)zvec_const_abs, 0 };
+    }
+    zvec_format fmt = zvec_format { (u8)zvec_block_abs, (u8)max_size };
+    if (zvec_size_bits((zvec_size)s.xsize) < zvec_size_bits((zvec_size)fmt.size)) {
+        fmt = zvec_format { (u8)zvec_block_xor, s.xsize };
+    }
+    if (s.msize != zvec_size_0 &&
+        zvec_size_bits((zvec_size)s.msize) <= zvec_size_bits((zvec_size)fmt.size) &&
+        (zvec_size)s.msize != max_size) {
+        fmt = zvec_format { (u8)zvec_block_decimal, s.msize };
+    }
+    return fmt;
+}
+
+template <typename F>
+zvec_meta<F> zvec_float_metadata(zvec_stats<F> s)
+{
+    zvec_format fmt = zvec_float_format(s);
+    switch (fmt.codec) {
+    case zvec_const_abs: return zvec_meta<F> { s.iv, 0 };
+    case zvec_block_xor: return zvec_meta<F> { s.iv, (F)s.xshift };
+    case zvec_block_decimal: return zvec_meta<F> { (F)s.mmin, (F)s.mexp };
+    default: return zvec_meta<F> { 0, 0 };
+    }
+}
+
+template <typename F>
+void zvec_float_encode(F * __restrict in, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta)
+{
+    typedef typename zvec_float_traits<F>::U U;
+    typedef typename zvec_float_traits<F>::I I;
+    switch (fmt.codec) {
+    case zvec_block_xor: {
+        alignas(64) U tmp[zvec_scratch_max / sizeof(U)];
+        zvec_block_xor_delta((U*)in, tmp, n, zvec_float_bits(meta.iv), (int)meta.dv);
+        zvec_block_encode_for(tmp, comp, n, (zvec_size)fmt.size, (U)0);
+        break;
+    }
+    case zvec_block_decimal: {
+        alignas(64) I tmp[zvec_scratch_max / sizeof(I)];
+        for (size_t i = 0; i < n; i++) {
+            zvec_float_decimal(in[i], (int)meta.dv, tmp[i]);
+        }
+        zvec_block_encode_for(tmp, comp, n, (zvec_size)fmt.size, (I)meta.iv);
+        break;
+    }
+    case zvec_const_abs:
+        break;
+    default:
+        abort();
+    }
+}
+
+template <typename F>
+void zvec_float_decode_decimal(F * __restrict x, size_t n, F p)
+{
+    if constexpr (sizeof(F) == 8) get_zvec_ops_f64()->decode_decimal(x, n, p);
+    if constexpr (sizeof(F) == 4) get_zvec_ops_f32()->decode_decimal(x, n, p);
+}
+
+template <typename F>
+void zvec_float_decode(F * __restrict out, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta)
+{
+    typedef typename zvec_float_traits<F>::U U;
+    typedef typename zvec_float_traits<F>::I I;
+    switch (fmt.codec) {
+    case zvec_block_xor:
+        zvec_block_decode_for((U*)out, comp, n, (zvec_size)fmt.size, (U)0);
+        zvec_block_xor_prefix((U*)out, n, zvec_float_bits(meta.iv), (int)meta.dv);
+        break;
+    case zvec_block_decimal:
+        zvec_block_decode_for((I*)out, comp, n, (zvec_size)fmt.size, (I)meta.iv);
+        zvec_float_decode_decimal(out, n, (F)zvec_pow10[(int)meta.dv]);
+        break;
+    case zvec_const_abs:
+        zvec_block_synth_abs((U*)out, n, zvec_float_bits(meta.iv));
+        break;
+    default:
+        abort();
+    }
+}
+
+template <typename F>
+zvec_aggr<F> zvec_float_reduce_raw(F * __restrict x, size_t n)
+{
+    if constexpr (sizeof(F) == 8) return get_zvec_ops_f64()->reduce(x, n);
+    if constexpr (sizeof(F) == 4) return get_zvec_ops_f32()->reduce(x, n);
+}
+
+template <typename F>
+size_t zvec_float_count_raw(F * __restrict x, size_t n, F lo, F hi)
+{
+    if constexpr (sizeof(F) == 8) return get_zvec_ops_f64()->count(x, n, lo, hi);
+    if constexpr (sizeof(F) == 4) return get_zvec_ops_f32()->count(x, n, lo, hi);
+}
+
+template <typename F>
+size_t zvec_float_match_raw(F * __restrict x, size_t n, F lo, F hi, u64 * __restrict bits)
+{
+    if constexpr (sizeof(F) == 8) return get_zvec_ops_f64()->match(x, n, lo, hi, bits);
+    if constexpr (sizeof(F) == 4) return get_zvec_ops_f32()->match(x, n, lo, hi, bits);
+}
+
+/*
+ * floating point sums depend on the order of addition so blocks are always
+ * decoded and reduced with the raw kernel, which gives the same result for
+ * a page whether it is resident or compressed.
+ */
+
+template <typename F>
+zvec_aggr<F> zvec_float_reduce(F * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta)
+{
+    zvec_float_decode(tmp, comp, n, fmt, meta);
+    return zvec_float_reduce_raw(tmp, n);
+}
+
+template <typename F>
+size_t zvec_float_count(F * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta, F lo, F hi)
+{
+    if (fmt.codec == zvec_const_abs) {
+        return meta.iv >= lo && meta.iv <= hi ? n : 0;
+    }
+    zvec_float_decode(tmp, comp, n, fmt, meta);
+    return zvec_float_count_raw(tmp, n, lo, hi);
+}
+
+template <typename F>
+bool zvec_float_has_access(zvec_format fmt)
+{
+    int b = zvec_size_bits((zvec_size)fmt.size);
+    switch (fmt.codec) {
+    case zvec_block_decimal: return b != 24 && b != 48;
+    case zvec_const_abs: return true;
+    default: return false;
+    }
+}
+
+template <typename F>
+F zvec_float_access(void * __restrict comp, size_t /*n*/, zvec_format fmt, zvec_meta<F> meta, size_t i)
+{
+    typedef typename zvec_float_traits<F>::U U;
+    typedef typename zvec_float_traits<F>::I I;
+    int b = zvec_size_bits((zvec_size)fmt.size);
+    switch (fmt.codec) {
+    case zvec_block_decimal: {
+        U o = b == 8 ? ((u8*)comp)[i] : b == 16 ? ((u16*)comp)[i] :
+              b == 32 ? ((u32*)comp)[i] : zvec_bits_get<U>(comp, b, i);
+        return (F)(I)((U)(I)meta.iv + o) / (F)zvec_pow10[(int)meta.dv];
+    }
+    case zvec_const_abs:
+        return meta.iv;
+    default:
+        abort();
+    }
+    return 0;
+}
+
+/* block interface specializations for float and double */
+
+#define ZVEC_FLOAT_BLOCK(F) \
+template <> inline zvec_stats<F> zvec_block_scan(F * __restrict in, size_t n, zvec_codec codec) \
+{ return zvec_float_scan(in, n, codec); } \
+template <> inline zvec_stats<F> zvec_block_scan_pfor(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_dict(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_lin(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_dod(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_gcd(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_mini(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_stats<F> zvec_block_scan_svb(F * __restrict /*x*/, size_t /*n*/, zvec_stats<F> s) { return s; } \
+template <> inline zvec_format zvec_block_format(zvec_stats<F> s, size_t /*n*/) \
+{ return zvec_float_format(s); } \
+template <> inline zvec_meta<F> zvec_block_metadata(zvec_stats<F> s, size_t /*n*/) \
+{ return zvec_float_metadata(s); } \
+template <> inline void zvec_block_encode(F * __restrict in, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta) \
+{ zvec_float_encode(in, comp, n, fmt, meta); } \
+template <> inline void zvec_block_decode(F * __restrict out, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta) \
+{ zvec_float_decode(out, comp, n, fmt, meta); } \
+template <> inline zvec_aggr<F> zvec_block_reduce_raw(F * __restrict x, size_t n) \
+{ return zvec_float_reduce_raw(x, n); } \
+template <> inline size_t zvec_block_count_raw(F * __restrict x, size_t n, F lo, F hi) \
+{ return zvec_float_count_raw(x, n, lo, hi); } \
+template <> inline size_t zvec_block_match_raw(F * __restrict x, size_t n, F lo, F hi, u64 * __restrict bits) \
+{ return zvec_float_match_raw(x, n, lo, hi, bits); } \
+template <> inline zvec_aggr<F> zvec_block_reduce(F * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta) \
+{ return zvec_float_reduce(tmp, comp, n, fmt, meta); } \
+template <> inline size_t zvec_block_count(F * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta, F lo, F hi) \
+{ return zvec_float_count(tmp, comp, n, fmt, meta, lo, hi); } \
+template <> inline bool zvec_block_has_access<F>(zvec_format fmt) \
+{ return zvec_float_has_access<F>(fmt); } \
+template <> inline F zvec_block_access(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta, size_t i) \
+{ return zvec_float_access(comp, n, fmt, meta, i); } \
+template <> inline bool zvec_block_has_first<F>(zvec_format fmt) \
+{ return zvec_float_has_access<F>(fmt); } \
+template <> inline F zvec_block_first(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<F> meta) \
+{ return zvec_float_access(comp, n, fmt, meta, 0); } \
+template <> inline F zvec_series_value(F iv, F dv, size_t i) \
+{ return iv + (F)(i + 1) * dv; }
+
+ZVEC_FLOAT_BLOCK(f64)
+ZVEC_FLOAT_BLOCK(f32)
+
+#undef ZVEC_FLOAT_BLOCK
@@ -0,0 +1,202 @@
+/*
+ * PLEASE LICENSE 2022, Michael Clark <michaeljclark@mac.com>
+ *
+ * All rights to this work are granted for all purposes, with exception of
+ * author's implied right of copyright to defend the free use of this work.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+/*
+ * 16-bit and 8-bit blocks use a subset of the codecs with their own op
+ * tables. sums wrap at the element width as they do for wider types.
+ *
+ * - constant and constant delta blocks with iv and dv in the page index.
+ *
+ * - absolute blocks of 1-12 bit values for 16-bit types and 1-6 bit
+ *   values for 8-bit types. 8-bit values of 16-bit types are stored as
+ *   bytes. absolute blocks can read one element without decoding.
+ *
+ * - relative blocks of signed deltas at the same widths, with the first
+ *   element in iv.
+ *
+ * blocks that do not compress are stored in place as absolute blocks.
+ */
+
+/* ties prefer absolute blocks which can read one element without decoding */
+
+template <typename T>
+zvec_format zvec_small_format(zvec_stats<T> s)
+{
+    if (s.dmin == s.dmax) {
+        if (s.dmin == 0) {
+            return zvec_format { (u8)zvec_const_abs, 0 };
+        } else {
+            return zvec_format { (u8)zvec_const_rel, 0 };
+        }
+    }
+    zvec_size size_abs = zvec_size_abs(s);
+    zvec_size size_rel = zvec_size_rel(s);
+    if (size_rel < size_abs) {
+        return zvec_format { (u8)zvec_block_rel, (u8)size_rel };
+    } else {
+        return zvec_format { (u8)zvec_block_abs, (u8)size_abs };
+    }
+}
+
+template <typename T>
+zvec_meta<T> zvec_small_metadata(zvec_stats<T> s)
+{
+    zvec_format fmt = zvec_small_format(s);
+    switch (fmt.codec) {
+    case zvec_block_rel: return zvec_meta<T> { s.iv, 0 };
+    case zvec_const_abs: return zvec_meta<T> { s.iv, 0 };
+    case zvec_const_rel: return zvec_meta<T> { s.iv, (T)s.dmin };
+    default: return zvec_meta<T> { 0, 0 };
+    }
+}
+
+template <typename T>
+void zvec_small_encode(T * __restrict in, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta)
+{
+    switch (fmt.codec) {
+    case zvec_block_abs:
+        zvec_block_encode_abs(in, comp, n, (zvec_size)fmt.size);
+        break;
+    case zvec_block_rel:
+        zvec_block_encode_rel(in, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_const_abs:
+    case zvec_const_rel:
+        break;
+    default:
+        abort();
+    }
+}
+
+template <typename T>
+void zvec_small_decode(T * __restrict out, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta)
+{
+    switch (fmt.codec) {
+    case zvec_block_abs:
+        zvec_block_decode_abs(out, comp, n, (zvec_size)fmt.size);
+        break;
+    case zvec_block_rel:
+        zvec_block_decode_rel(out, comp, n, (zvec_size)fmt.size, meta.iv);
+        break;
+    case zvec_const_abs:
+        zvec_block_synth_abs(out, n, meta.iv);
+        break;
+    case zvec_const_rel:
+        zvec_block_synth_rel(out, n, meta.iv, meta.dv);
+        break;
+    default:
+        abort();
+    }
+}
+
+template <typename T>
+zvec_aggr<T> zvec_small_reduce(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta)
+{
+    using U = typename std::make_unsigned<T>::type;
+    if (fmt.codec == zvec_const_abs) {
+        return zvec_aggr<T>{ (T)((u64)n * (U)meta.iv), meta.iv, meta.iv };
+    }
+    zvec_small_decode(tmp, comp, n, fmt, meta);
+    return zvec_block_reduce_raw(tmp, n);
+}
+
+template <typename T>
+size_t zvec_small_count(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta, T lo, T hi)
+{
+    if (fmt.codec == zvec_const_abs) {
+        return meta.iv >= lo && meta.iv <= hi ? n : 0;
+    }
+    zvec_small_decode(tmp, comp, n, fmt, meta);
+    return zvec_block_count_raw(tmp, n, lo, hi);
+}
+
+template <typename T>
+bool zvec_small_has_access(zvec_format fmt)
+{
+    switch (fmt.codec) {
+    case zvec_block_abs: return true;
+    case zvec_const_abs: return true;
+    case zvec_const_rel: return true;
+    default: return false;
+    }
+}
+
+/* packed values of signed types are sign-extended from the top bit */
+
+template <typename T>
+T zvec_small_access(void * __restrict comp, size_t /*n*/, zvec_format fmt, zvec_meta<T> meta, size_t i)
+{
+    using U = typename std::make_unsigned<T>::type;
+    typedef typename std::conditional<std::is_signed<T>::value,i8,u8>::type x8;
+    constexpr int W = sizeof(T) * 8;
+    switch (fmt.codec) {
+    case zvec_block_abs: {
+        int b = zvec_size_bits((zvec_size)fmt.size);
+        if (b == 8) return (T)((x8*)comp)[i];
+        U v = zvec_bits_get<U>(comp, b, i);
+        if constexpr (std::is_signed<T>::value) {
+            return (T)((int)(T)(U)(v << (W - b)) >> (W - b));
+        }
+        return (T)v;
+    }
+    case zvec_const_abs:
+        return meta.iv;
+    case zvec_const_rel:
+        return zvec_series_value(meta.iv, meta.dv, i);
+    default:
+        abort();
+    }
+    return 0;
+}
+
+/* block interface specializations for 16-bit and 8-bit types */
+
+#define ZVEC_SMALL_BLOCK(T) \
+template <> inline zvec_stats<T> zvec_block_scan_pfor(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_dict(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_lin(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_dod(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_gcd(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_mini(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_stats<T> zvec_block_scan_svb(T * __restrict /*x*/, size_t /*n*/, zvec_stats<T> s) { return s; } \
+template <> inline zvec_format zvec_block_format(zvec_stats<T> s, size_t /*n*/) \
+{ return zvec_small_format(s); } \
+template <> inline zvec_meta<T> zvec_block_metadata(zvec_stats<T> s, size_t /*n*/) \
+{ return zvec_small_metadata(s); } \
+template <> inline void zvec_block_encode(T * __restrict in, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta) \
+{ zvec_small_encode(in, comp, n, fmt, meta); } \
+template <> inline void zvec_block_decode(T * __restrict out, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta) \
+{ zvec_small_decode(out, comp, n, fmt, meta); } \
+template <> inline zvec_aggr<T> zvec_block_reduce(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta) \
+{ return zvec_small_reduce(tmp, comp, n, fmt, meta); } \
+template <> inline size_t zvec_block_count(T * __restrict tmp, void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta, T lo, T hi) \
+{ return zvec_small_count(tmp, comp, n, fmt, meta, lo, hi); } \
+template <> inline bool zvec_block_has_access<T>(zvec_format fmt) \
+{ return zvec_small_has_access<T>(fmt); } \
+template <> inline T zvec_block_access(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta, size_t i) \
+{ return zvec_small_access(comp, n, fmt, meta, i); } \
+template <> inline bool zvec_block_has_first<T>(zvec_format fmt) \
+{ return zvec_small_has_access<T>(fmt); } \
+template <> inline T zvec_block_first(void * __restrict comp, size_t n, zvec_format fmt, zvec_meta<T> meta) \
+{ return zvec_small_access(comp, n, fmt, meta, 0); }
+
+ZVEC_SMALL_BLOCK(i16)
+ZVEC_SMALL_BLOCK(u16)
+ZVEC_SMALL_BLOCK(i8)
+ZVEC_SMALL_BLOCK(u8)
+
+#undef ZVEC_SMALL_BLOCK
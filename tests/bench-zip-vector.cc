@@ -12,6 +12,7 @@
 #include <string>
 #include <random>
 #include <chrono>
+#include <thread>
 #include <utility>
 
 using namespace std::chrono;
@@ -272,19 +273,17 @@ static __attribute__((noinline)) void bench_zip_vector_2D(std::string suffix, si
         x1 += (vec[i] = (rng.*func)());
     }
 
-    for (size_t i = 0; i < n; i += decltype(vec)::page_interval) {
-        T *cur = &vec[i], *end = cur + decltype(vec)::page_interval;
-        while(cur != end) x2 += *cur++;
-    }
+    vec.for_each_cpage([&] (size_t y, auto span) {
+        for (T x : span) x2 += x;
+    });
     if (x1 != x2) abort();
 
     for (size_t h = 0; h < runs; h++) {
         x2 = 0;
         timepoint t1 = high_resolution_clock::now();
-        for (size_t i = 0; i < n; i += decltype(vec)::page_interval) {
-            T *cur = &vec[i], *end = cur + decltype(vec)::page_interval;
-            while(cur != end) x2 += *cur++;
-        }
+        vec.for_each_cpage([&] (size_t y, auto span) {
+            for (T x : span) x2 += x;
+        });
         timepoint t2 = high_resolution_clock::now();
         if (x1 != x2) abort();
         collect_result(h == runs - 1,
@@ -292,6 +291,83 @@ static __attribute__((noinline)) void bench_zip_vector_2D(std::string suffix, si
     }
 }
 
+template <typename T, typename R>
+static __attribute__((noinline)) void bench_zip_vector_MT(std::string suffix, size_t runs, size_t n, T(R::*func)())
+{
+    R rng;
+    zip_vector<T> vec;
+
+    size_t num_threads = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+    std::vector<T> sums(num_threads);
+    std::vector<std::thread> threads;
+    T x1 = 0, x2 = 0;
+
+    vec.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        x1 += (vec[i] = (rng.*func)());
+    }
+    vec.sync();
+
+    /* each thread reads its own range with an accessor */
+    auto sum_ranges = [&] () {
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back([&, t] {
+                typename zip_vector<T>::accessor a(vec);
+                T s = 0;
+                for (size_t i = n * t / num_threads; i < n * (t + 1) / num_threads; i++) {
+                    s += a.get(i);
+                }
+                sums[t] = s;
+            });
+        }
+        for (auto &th : threads) th.join();
+        threads.clear();
+        T s = 0;
+        for (T x : sums) s += x;
+        return s;
+    };
+
+    x2 = sum_ranges();
+    if (x1 != x2) abort();
+
+    for (size_t h = 0; h < runs; h++) {
+        timepoint t1 = high_resolution_clock::now();
+        x2 = sum_ranges();
+        timepoint t2 = high_resolution_clock::now();
+        if (x1 != x2) abort();
+        collect_result(h == runs - 1,
+            {format_string("zip_vector_MT%s", suffix.c_str()), n, t1, t2});
+    }
+}
+
+template <typename T, typename R>
+static __attribute__((noinline)) void bench_zip_vector_PB(std::string suffix, size_t runs, size_t n, T(R::*func)(), bool refs)
+{
+    R rng;
+    std::vector<T> src;
+
+    T x1 = 0, x2 = 0;
+
+    src.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        x1 += (src[i] = (rng.*func)());
+    }
+
+    /* append and seal each page, with and without the reference search */
+    for (size_t h = 0; h < runs; h++) {
+        zip_vector<T> vec;
+        vec.set_ref_pages(refs);
+        timepoint t1 = high_resolution_clock::now();
+        for (T x : src) vec.push_back(x);
+        vec.sync();
+        timepoint t2 = high_resolution_clock::now();
+        x2 = vec.sum();
+        if (x1 != x2) abort();
+        collect_result(h == runs - 1,
+            {format_string("zip_vector_PB%s%s", refs ? "_ref" : "", suffix.c_str()), n, t1, t2});
+    }
+}
+
 template <typename T, typename R>
 static void bench_vector(std::string suffix, size_t test, size_t runs, size_t n, T(R::*func)())
 {
@@ -299,6 +375,9 @@ static void bench_vector(std::string suffix, size_t test, size_t runs, size_t n,
     case 0: bench_std_vector_1D(suffix, runs, n, func); break;
     case 1: bench_zip_vector_1D(suffix, runs, n, func); break;
     case 2: bench_zip_vector_2D(suffix, runs, n, func); break;
+    case 3: bench_zip_vector_MT(suffix, runs, n, func); break;
+    case 4: bench_zip_vector_PB(suffix, runs, n, func, false); break;
+    case 5: bench_zip_vector_PB(suffix, runs, n, func, true); break;
     default: break;
     }
 }
@@ -308,7 +387,7 @@ bool run_bench(int num) { return bench_num == num || bench_num == -1; }
 template <typename T>
 static void bench_zip_vector()
 {
-    for (size_t test_num = 0; test_num < 3; test_num++) {
+    for (size_t test_num = 0; test_num < 6; test_num++) {
         print_header();
         if (run_bench(1)) bench_vector<T>("-abs-8", test_num, bench_runs, bench_size, &bench_random<T>::abs_i7);
         if (run_bench(2)) bench_vector<T>("-rel-8", test_num, bench_runs, bench_size, &bench_random<T>::rel_i7);
@@ -0,0 +1,68 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void t1(size_t slots)
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536, Q = zip_vector<T>::page_interval };
+
+    zvec.set_slots(slots);
+
+    /* write random values to array and check array */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = zvec[i] = rng.val();
+    }
+
+    /* alternate between pages with reads and writes a[i] -= a[i-Q] */
+    for (size_t i = test_size - 1; i >= Q; i--) {
+        cvec[i] -= cvec[i-Q];
+        zvec[i] = zvec[i] - zvec[i-Q];
+    }
+
+    /* random access touching more pages than slots */
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+    for (size_t j = 0; j < test_size; j++) {
+        size_t i = dist(engine);
+        cvec[i] += (T)j;
+        zvec[i] = zvec[i] + (T)j;
+    }
+
+    /* check against control vector before and after sync */
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    zvec.sync();
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    zvec.sync();
+
+    /* check slots have been released and slab holds only page blocks */
+    size_t used = 0;
+    for (size_t y = 0; y < zvec.f_page_num(zvec._count); y++) {
+        used += zvec_block_size<T>(zvec._page_idx[y].format, Q);
+    }
+    assert(bitmap_count(zvec) << 6 == used);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    for (size_t slots : { 1, 2, 4, 16 }) {
+        t1<i64>(slots);
+        t1<i32>(slots);
+    }
+}
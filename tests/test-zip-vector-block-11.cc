@@ -0,0 +1,97 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536, Q = zip_vector<T>::page_interval };
+
+    /* write random values through the iterator */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    std::copy(cvec.begin(), cvec.end(), zvec.begin());
+    assert(zvec.end() - zvec.begin() == (std::ptrdiff_t)test_size);
+
+    /* check sum with const iterator and range-for */
+    T s1 = std::accumulate(cvec.begin(), cvec.end(), (T)0);
+    T s2 = std::accumulate(zvec.cbegin(), zvec.cend(), (T)0);
+    T s3 = 0;
+    for (auto v : zvec) {
+        s3 += (T)v;
+    }
+    assert(s1 == s2);
+    assert(s1 == s3);
+
+    /* two iterators a page apart writing a[i] -= a[i-Q] */
+    auto it = zvec.end();
+    while (it - Q > zvec.begin()) {
+        --it;
+        *it = *it - it[-(std::ptrdiff_t)Q];
+    }
+    for (size_t i = test_size - 1; i >= Q; i--) {
+        cvec[i] -= cvec[i-Q];
+    }
+
+    /* same again holding the reference with one slot so it is evicted */
+    zvec.set_slots(1);
+    it = zvec.end();
+    while (it - Q > zvec.begin()) {
+        --it;
+        auto r = *it;
+        T d = it[-(std::ptrdiff_t)Q];
+        r = (T)r - d;
+    }
+    for (size_t i = test_size - 1; i >= Q; i--) {
+        cvec[i] -= cvec[i-Q];
+    }
+    zvec.set_slots(zip_vector<T>::default_slots);
+
+    /* random access with iterator arithmetic */
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+    auto b = zvec.begin();
+    for (size_t j = 0; j < test_size; j++) {
+        size_t i = dist(engine);
+        b += i;
+        *b = *b + (T)j;
+        b -= i;
+        cvec[i] += (T)j;
+    }
+
+    /* forward walk with reads of another page evicting it between steps */
+    zvec.set_slots(1);
+    auto f = zvec.cbegin();
+    for (size_t i = 0; i < test_size; i++, ++f) {
+        assert(*f == cvec[i]);
+        assert((T)zvec[(i + Q) % test_size] == cvec[(i + Q) % test_size]);
+        assert(*f == cvec[i]);
+    }
+    zvec.set_slots(zip_vector<T>::default_slots);
+
+    /* check against control vector */
+    zvec.sync();
+    assert(std::equal(cvec.begin(), cvec.end(), zvec.cbegin()));
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
@@ -0,0 +1,70 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+#include <algorithm>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec, cout, csort;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536, half = test_size / 2 };
+
+    /* write two sorted halves */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    std::sort(cvec.begin(), cvec.begin() + half);
+    std::sort(cvec.begin() + half, cvec.end());
+    for (size_t i = 0; i < cvec.size(); i++) {
+        zvec[i] = cvec[i];
+    }
+
+    /* merge the halves using two cursors */
+    typename zip_vector<T>::cursor a(zvec, 0), b(zvec, half);
+    cout.reserve(test_size);
+    while (a.idx < (i64)half && b.idx < (i64)test_size) {
+        if (*b < *a) {
+            cout.push_back(*b); ++b;
+        } else {
+            cout.push_back(*a); ++a;
+        }
+    }
+    while (a.idx < (i64)half) { cout.push_back(*a); ++a; }
+    while (b.idx < (i64)test_size) { cout.push_back(*b); ++b; }
+    csort = cvec;
+    std::sort(csort.begin(), csort.end());
+    assert(cout == csort);
+
+    /* cursors observe writes to pages in the page cache */
+    zvec[7] = 42;
+    typename zip_vector<T>::cursor c(zvec, 7);
+    assert(*c == 42);
+    cvec[7] = 42;
+
+    /* check page access against control vector */
+    typename zip_vector<T>::cursor d(zvec);
+    for (size_t i = 0; i < test_size; i += zip_vector<T>::page_interval) {
+        d.seek(i);
+        assert(std::equal(d.page(), d.page() + zip_vector<T>::page_interval,
+            cvec.begin() + i));
+    }
+
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
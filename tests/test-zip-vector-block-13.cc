@@ -0,0 +1,69 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536 + 100, Q = zip_vector<T>::page_interval };
+
+    /* write random values using mutable page spans */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    size_t count = 0;
+    zvec.for_each_page([&] (size_t y, typename zip_vector<T>::span span) {
+        for (size_t x = 0; x < span.size; x++) {
+            span[x] = cvec[y * Q + x];
+        }
+        count += span.size;
+    });
+    assert(count == test_size);
+    zvec.sync();
+
+    /* check sum using const page spans which must not dirty pages */
+    T s1 = 0, s2 = 0;
+    for (auto v : cvec) {
+        s1 += v;
+    }
+    zvec.for_each_cpage([&] (size_t y, typename zip_vector<T>::const_span span) {
+        for (T v : span) {
+            s2 += v;
+        }
+        assert(!zvec._dirty);
+    });
+    assert(s1 == s2);
+    for (size_t s = 0; s < zvec._slot_count; s++) {
+        assert(!zvec._slots[s].dirty);
+    }
+
+    /* writes through element addresses must mark pages dirty */
+    for (size_t i = 0; i < test_size; i += Q) {
+        *&zvec[i] = (T)i;
+        cvec[i] = (T)i;
+    }
+    zvec.sync();
+    for (size_t i = 0; i < test_size; i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
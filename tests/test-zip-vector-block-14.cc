@@ -0,0 +1,61 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec, buf;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536, num_ranges = 256, align = 64 / sizeof(T) };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, test_size);
+
+    /* bulk assign of the whole array */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    zvec.assign(0, cvec.data(), test_size);
+
+    /* bulk assign and copy out random ranges with random alignment */
+    buf.resize(test_size + align * 2);
+    for (size_t j = 0; j < num_ranges; j++) {
+        size_t b = dist(engine), e = dist(engine);
+        if (b > e) std::swap(b, e);
+        T *p = (T*)(((uintptr_t)buf.data() + 63) & ~(uintptr_t)63) + (j & 1);
+        for (size_t i = b; i < e; i++) {
+            p[i - b] = cvec[i] = rng.val();
+        }
+        zvec.assign(b, p, e - b);
+        if ((j & 2) && b < e) zvec[b] = zvec[b] + 1, cvec[b] += 1;
+
+        size_t b2 = dist(engine), e2 = dist(engine);
+        if (b2 > e2) std::swap(b2, e2);
+        zvec.copy_out(b2, e2 - b2, p);
+        assert(std::equal(p, p + (e2 - b2), cvec.begin() + b2));
+    }
+
+    /* check against control vector */
+    zvec.sync();
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
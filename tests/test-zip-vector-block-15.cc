@@ -0,0 +1,60 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536 + 37, Q = zip_vector<T>::page_interval };
+
+    /* append elements one at a time */
+    for (size_t i = 0; i < test_size; i++) {
+        T v = rng.val();
+        cvec.push_back(v);
+        zvec.push_back(v);
+        assert((size_t)zvec.size() == cvec.size());
+    }
+
+    /* full pages are sealed as they are appended */
+    for (size_t s = 0; s < zvec._slot_count; s++) {
+        assert(!zvec._slots[s].dirty ||
+            zvec._slots[s].page == zvec.f_page_num(test_size));
+    }
+
+    /* bulk append and emplace */
+    std::vector<T> tail(test_size);
+    for (auto &v : tail) {
+        v = rng.val();
+    }
+    zvec.append(tail.data(), tail.size());
+    cvec.insert(cvec.end(), tail.begin(), tail.end());
+    zvec.emplace_back((T)42);
+    cvec.emplace_back((T)42);
+    assert((size_t)zvec.size() == cvec.size());
+
+    /* check against control vector before and after sync */
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    zvec.sync();
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
@@ -0,0 +1,127 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, std::vector<T> &probes)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    T min = std::numeric_limits<T>::max(), max = std::numeric_limits<T>::min();
+    for (T x : cvec) {
+        sum += (U)x;
+        min = std::min(min, x);
+        max = std::max(max, x);
+    }
+    zvec_aggr<T> a = zvec.aggregate();
+    assert(a.sum == (T)sum && zvec.sum() == (T)sum);
+    assert(a.min == min && zvec.min() == min);
+    assert(a.max == max && zvec.max() == max);
+
+    probes.push_back(std::numeric_limits<T>::min());
+    probes.push_back(std::numeric_limits<T>::max());
+    probes.push_back(0);
+    for (T v : probes) {
+        size_t c[6] = { 0 };
+        for (T x : cvec) {
+            c[zvec_cmp_eq] += x == v;
+            c[zvec_cmp_ne] += x != v;
+            c[zvec_cmp_lt] += x < v;
+            c[zvec_cmp_le] += x <= v;
+            c[zvec_cmp_gt] += x > v;
+            c[zvec_cmp_ge] += x >= v;
+        }
+        for (int cmp = zvec_cmp_eq; cmp <= zvec_cmp_ge; cmp++) {
+            assert(zvec.count_if((zvec_cmp)cmp, v) == c[cmp]);
+        }
+    }
+}
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec, probes;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+    enum : size_t { test_size = page_interval * 64 + 123 };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+
+    /* random block formats with a partial last page */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    zvec.assign(0, cvec.data(), test_size);
+    for (size_t i = 0; i < 64; i++) {
+        probes.push_back(cvec[dist(engine)]);
+    }
+    check(zvec, cvec, probes);
+
+    /* dirty resident pages are reduced from the page cache */
+    for (size_t i = 0; i < 4; i++) {
+        size_t j = dist(engine);
+        zvec[j] = cvec[j] = cvec[j] * 3 + 1;
+    }
+    check(zvec, cvec, probes);
+    zvec.sync();
+    check(zvec, cvec, probes);
+
+    dump_index(zvec);
+}
+
+template<typename T>
+void t2()
+{
+    std::vector<T> cvec, page, probes;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    /* constant, arithmetic series, wrapping series and narrow pages */
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+    add_page([](size_t i) { return (T)7; });
+    add_page([](size_t i) { return (T)(1000 + i * 3); });
+    add_page([](size_t i) { return (T)(1000000 - i * 5); });
+    add_page([](size_t i) { return (T)((T)-200 + i); });
+    add_page([](size_t i) { return (T)((i * 37) % 251); });
+    add_page([](size_t i) { return (T)((i * 7919) % 65521); });
+    add_page([](size_t i) { return (T)(i * 0x9e3779b97f4a7c15ull); });
+    add_page([](size_t i) { return std::numeric_limits<T>::max() - (T)(i & 3); });
+
+    /* zero pages that were never written */
+    cvec.resize(cvec.size() + page_interval * 2);
+    zvec.resize(cvec.size());
+
+    zvec.sync();
+    for (T v : { (T)7, (T)1000, (T)1003, (T)2534, (T)999995, (T)-100, (T)250,
+                 (T)65000, (T)(std::numeric_limits<T>::max() - 2) }) {
+        probes.push_back(v);
+    }
+    check(zvec, cvec, probes);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+    t2<i64>();
+    t2<u64>();
+    t2<u32>();
+}
@@ -0,0 +1,106 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, T lo, T hi)
+{
+    std::vector<size_t> cidx, zidx;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        if (cvec[i] >= lo && cvec[i] <= hi) cidx.push_back(i);
+    }
+    zvec.filter(lo, hi, [&](size_t i) { zidx.push_back(i); });
+    assert(cidx == zidx);
+    assert(zvec.count_range(lo, hi) == cidx.size());
+
+    /* find each match in turn and from the middle of the vector */
+    size_t i = 0, j = 0;
+    while ((i = zvec.find_if(lo, hi, i)) < cvec.size()) {
+        assert(j < cidx.size() && cidx[j++] == i++);
+    }
+    assert(j == cidx.size());
+    auto m = std::lower_bound(cidx.begin(), cidx.end(), cvec.size() / 2);
+    assert((size_t)zvec.find_if(lo, hi, cvec.size() / 2) ==
+        (m == cidx.end() ? cvec.size() : *m));
+}
+
+template<typename T>
+void check_zones(zip_vector<T> &zvec)
+{
+    for (size_t y = 0; y < zvec.page_count(); y++) {
+        T min = std::numeric_limits<T>::max(), max = std::numeric_limits<T>::min();
+        for (size_t x = 0; x < zip_vector<T>::page_interval; x++) {
+            T v = zvec[y * zip_vector<T>::page_interval + x];
+            min = std::min(min, v), max = std::max(max, v);
+        }
+        assert(zvec._page_zone[y].min == min && zvec._page_zone[y].max == max);
+    }
+    zvec.sync();
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+    enum : size_t { test_size = page_interval * 64 };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<T> noise(-50, 50);
+    std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+
+    /* time-bucketed data with noise, a few pages left as zero pages */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < page_interval * 60; i++) {
+        cvec[i] = (T)(i * 10 + noise(engine));
+    }
+    zvec.assign(0, cvec.data(), test_size);
+    zvec.set_zone_maps(true);
+    check_zones(zvec);
+
+    T top = (T)(page_interval * 600);
+    check(zvec, cvec, (T)12345, (T)23456);
+    check(zvec, cvec, (T)0, (T)0);
+    check(zvec, cvec, (T)-100, (T)100);
+    check(zvec, cvec, (T)(top / 2), top);
+    check(zvec, cvec, top, std::numeric_limits<T>::max());
+    check(zvec, cvec, (T)5, (T)4);
+
+    /* writes leave resident pages that are scanned without their zones */
+    for (size_t i = 0; i < 16; i++) {
+        size_t j = dist(engine);
+        zvec[j] = cvec[j] = (T)(j & 1 ? 17000 : -17000);
+    }
+    check(zvec, cvec, (T)16000, (T)18000);
+    check(zvec, cvec, (T)-18000, (T)-16000);
+
+    /* zones are updated when pages are recompressed */
+    zvec.sync();
+    check_zones(zvec);
+    check(zvec, cvec, (T)16000, (T)18000);
+
+    /* partial last page and growth with zone maps enabled */
+    cvec.resize(test_size + 100, (T)42);
+    zvec.resize(test_size + 100);
+    for (size_t i = test_size; i < test_size + 100; i++) zvec[i] = (T)42;
+    zvec.sync();
+    check(zvec, cvec, (T)40, (T)45);
+
+    zvec.set_zone_maps(false);
+    check(zvec, cvec, (T)12345, (T)23456);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
@@ -0,0 +1,82 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, std::mt19937 &engine, size_t num_ranges)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::uniform_int_distribution<size_t> dist(0, cvec.size());
+
+    for (size_t j = 0; j < num_ranges; j++) {
+        size_t b = dist(engine), e = dist(engine);
+        if (b > e) std::swap(b, e);
+        U sum = 0;
+        for (size_t i = b; i < e; i++) sum += (U)cvec[i];
+        assert(zvec.range_sum(b, e - b) == (T)sum);
+    }
+    U sum = 0;
+    for (T x : cvec) sum += (U)x;
+    assert(zvec.range_sum(0, cvec.size()) == (T)sum);
+}
+
+template<typename T>
+void t1(bool prefix)
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+    enum : size_t { test_size = page_interval * 64 + 77, num_ranges = 256 };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = rng.val();
+    }
+    zvec.assign(0, cvec.data(), test_size);
+    zvec.set_prefix_index(prefix);
+    check(zvec, cvec, engine, num_ranges);
+
+    /* element writes leave dirty pages in the page cache */
+    for (size_t j = 0; j < 8; j++) {
+        for (size_t k = 0; k < 32; k++) {
+            size_t i = dist(engine);
+            zvec[i] = cvec[i] = rng.val();
+        }
+        check(zvec, cvec, engine, num_ranges / 8);
+    }
+
+    /* bulk assignment and appends */
+    for (size_t i = page_interval * 3; i < page_interval * 9; i++) {
+        cvec[i] = rng.val();
+    }
+    zvec.assign(page_interval * 3, cvec.data() + page_interval * 3, page_interval * 6);
+    for (size_t i = 0; i < page_interval * 3 + 5; i++) {
+        T v = rng.val();
+        cvec.push_back(v);
+        zvec.push_back(v);
+    }
+    check(zvec, cvec, engine, num_ranges);
+
+    zvec.sync();
+    check(zvec, cvec, engine, num_ranges);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(true);
+    t1<i32>(true);
+    t1<i64>(false);
+}
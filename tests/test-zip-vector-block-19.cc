@@ -0,0 +1,213 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, T v)
+{
+    size_t lb = std::lower_bound(cvec.begin(), cvec.end(), v) - cvec.begin();
+    size_t ub = std::upper_bound(cvec.begin(), cvec.end(), v) - cvec.begin();
+    assert((size_t)zvec.lower_bound(v) == lb);
+    assert((size_t)zvec.upper_bound(v) == ub);
+}
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    for (size_t i = 0; i < cvec.size(); i += 7) {
+        check(zvec, cvec, cvec[i]);
+        check(zvec, cvec, (T)(cvec[i] - 1));
+        check(zvec, cvec, (T)(cvec[i] + 1));
+    }
+    check(zvec, cvec, cvec.front());
+    check(zvec, cvec, cvec.back());
+    check(zvec, cvec, std::numeric_limits<T>::min());
+    check(zvec, cvec, std::numeric_limits<T>::max());
+}
+
+template<typename T>
+void t1(T base, std::vector<u64> dmax)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+
+    /* sorted pages of non-negative deltas, each with a maximum delta */
+    T v = base;
+    for (u64 d : dmax) {
+        std::uniform_int_distribution<u64> dist(0, d);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            page[i] = v = (T)(v + (i == 0 ? 1 : dist(engine)));
+        }
+        page[1] = page[0], page[2] = (T)(page[0] + d);
+        for (size_t i = 3; i < page_interval; i++) {
+            page[i] = std::max(page[i], page[i - 1]);
+        }
+        v = page.back();
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    }
+    zvec.sync();
+
+    /* unsigned deltas use half the width of signed deltas at each power */
+    for (size_t y = 0; y < dmax.size(); y++) {
+        auto idx = zvec._page_idx[y];
+        size_t bits = 8;
+        while (bits < 48 && dmax[y] >> bits) bits += 8;
+        if (bits == 40) bits = 48;
+        if (bits == 16 && dmax[y] < 4096) bits = 12;
+        assert(idx.format.codec == zvec_block_mono);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == (int)bits);
+        assert(idx.meta.iv == cvec[y * page_interval]);
+    }
+    check(zvec, cvec);
+    U sum = 0;
+    for (T x : cvec) sum += (U)x;
+    assert(zvec.sum() == (T)sum);
+
+    /* resident page with an order preserving write and a partial page */
+    size_t j = page_interval * dmax.size() / 2 + 5;
+    zvec[j] = cvec[j] = cvec[j - 1];
+    check(zvec, cvec);
+    for (size_t i = 0; i < 100; i++) {
+        cvec.push_back(cvec.back() + (T)(i & 1));
+        zvec.push_back(cvec.back());
+    }
+    zvec.sync();
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+template<typename T>
+void t2(T base)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval,
+                         W = sizeof(T) * 8, pages = 8 };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<U> dist(0, ((U)1 << (W*3/16)) - 1);
+    std::uniform_int_distribution<U> noise(0, 255);
+
+    /* sorted pages of strided values and a page of noise with outliers */
+    T v = base;
+    page.resize(page_interval);
+    for (size_t y = 0; y < pages; y++) {
+        if (y < pages - 1) {
+            for (size_t i = 0; i < page_interval; i++) {
+                page[i] = v = (T)((U)v + dist(engine) * ((U)1 << (W*3/8)));
+            }
+        } else {
+            for (size_t i = 0; i < page_interval; i++) {
+                page[i] = (T)((U)v + noise(engine));
+            }
+            std::sort(page.begin(), page.end());
+            for (size_t i = page_interval - 4; i < page_interval; i++) {
+                page[i] = (T)((U)v + ((U)1 << (W*3/4)) + i);
+            }
+        }
+        v = page.back();
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    }
+    zvec.sync();
+    for (size_t y = 0; y < pages; y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == (y < pages - 1 ? zvec_block_gcd : zvec_block_pfor));
+    }
+
+    /* the binary search reads first elements, decoding at most one page */
+    for (size_t i = 0; i < cvec.size(); i += 61) {
+        T x = (T)(cvec[i] + (T)(i & 1));
+        size_t lb = std::lower_bound(cvec.begin(), cvec.end(), x) - cvec.begin();
+        size_t d = zvec._page_decodes;
+        assert((size_t)zvec.lower_bound(x) == lb);
+        assert(zvec._page_decodes - d <= 1);
+    }
+
+    dump_index(zvec);
+}
+
+template<typename T>
+void t3()
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    enum test : size_t { n = zip_vector<T>::page_interval, W = sizeof(T) * 8 };
+
+    alignas(64) T in[n];
+    alignas(64) u64 comp[n];
+    std::mt19937 engine;
+
+    /* first element of each width read from the block matches the input */
+    auto check_first = [&](zvec_format fmt, zvec_meta<T> meta) {
+        memset(comp, 0, sizeof(comp));
+        zvec_block_encode(in, comp, n, fmt, meta);
+        assert(zvec_block_has_first<T>(fmt));
+        assert(zvec_block_first((void*)comp, n, fmt, meta) == in[0]);
+    };
+    for (int z = zvec_size_1; z < zvec_size_64; z++) {
+        int b = zvec_size_bits((zvec_size)z);
+        if (b >= (int)W) break;
+        std::uniform_int_distribution<U> dist(0, ((U)1 << b) - 1);
+        T g = (T)7, iv = (T)-12345;
+        for (size_t i = 0; i < n; i++) {
+            U o = dist(engine);
+            in[i] = (T)((U)iv + o);
+        }
+        in[0] = (T)((U)iv + ((U)1 << b) - 1);
+        in[1] = iv;
+        check_first(zvec_format { zvec_block_for, (u8)z }, zvec_meta<T> { iv, 0 });
+        for (size_t i = 0; i < n; i++) {
+            in[i] = (T)((U)(in[i] - iv) * (U)g + (U)iv);
+        }
+        check_first(zvec_format { zvec_block_gcd, (u8)z }, zvec_meta<T> { iv, g });
+        for (size_t i = 0; i < n; i++) {
+            U o = dist(engine);
+            in[i] = std::is_signed<T>::value ? (T)((T)(o << (W - b)) >> (W - b)) : (T)o;
+        }
+        check_first(zvec_format { zvec_block_abs, (u8)z }, zvec_meta<T> { 0, 0 });
+    }
+
+    /* patched blocks with an outlier in the first element */
+    for (zvec_size p : { zvec_size_0, zvec_size_4, zvec_size_8 }) {
+        int b = zvec_size_bits(p);
+        T iv = (T)1000;
+        for (size_t i = 0; i < n; i++) in[i] = (T)(iv + (T)(i & ((1 << b) - 1)));
+        in[0] = (T)(iv + (T)((U)3 << (W / 2)));
+        in[n - 1] = (T)(iv + (T)((U)5 << (W / 2)));
+        zvec_meta<T> meta { iv, (T)((U)p | (U)2 << 8) };
+        check_first(zvec_format { zvec_block_pfor, zvec_size_16 }, meta);
+    }
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(1000000000000ll, { 255, 65535, 1000, (1ull<<24)-1, 40000, (1ull<<32)-1, 1ull<<40 });
+    t1<u64>(1000000000000ull, { 255, 65535, 1000, (1ull<<24)-1, 40000, (1ull<<32)-1, 1ull<<40 });
+    t1<i32>(-1000000000, { 255, 65535, 1000, 200, 70000 });
+    t1<u32>(100000000u, { 255, 65535, 1000, 200, 70000 });
+    t2<i64>(-1000000000000ll);
+    t2<u64>(1000000000000ull);
+    t2<i32>(-1000000000);
+    t2<u32>(100000u);
+    t3<i64>();
+    t3<u64>();
+    t3<i32>();
+    t3<u32>();
+}
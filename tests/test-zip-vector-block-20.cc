@@ -0,0 +1,92 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<size_t> dist(0, cvec.size() - 1);
+
+    /* random access reads do not change the active page */
+    for (size_t i = 0; i < 1000; i++) {
+        size_t j = dist(engine);
+        assert(zvec.get(j) == cvec[j]);
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    for (size_t i = 0; i < cvec.size(); i += 13) {
+        size_t lb = std::lower_bound(cvec.begin(), cvec.end(), cvec[i]) - cvec.begin();
+        size_t ub = std::upper_bound(cvec.begin(), cvec.end(), (T)(cvec[i] + 1)) - cvec.begin();
+        assert((size_t)zvec.lower_bound(cvec[i]) == lb);
+        assert((size_t)zvec.upper_bound((T)(cvec[i] + 1)) == ub);
+    }
+    U sum = 0;
+    for (T x : cvec) sum += (U)x;
+    assert(zvec.sum() == (T)sum);
+}
+
+template<typename T>
+void t1(T base, std::vector<double> gaps, std::vector<int> bits)
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+
+    /*
+     * posting lists with geometric gaps of a mean, where the largest gap
+     * needs several more bits than the mean so elias-fano is smaller
+     * than unsigned deltas.
+     */
+    T v = base;
+    for (double g : gaps) {
+        std::geometric_distribution<u64> dist(1.0 / g);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            page[i] = v = (T)(v + 1 + dist(engine));
+        }
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    }
+    zvec.sync();
+
+    for (size_t y = 0; y < gaps.size(); y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == zvec_block_ef);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+        assert(idx.meta.iv == cvec[y * page_interval]);
+    }
+    check(zvec, cvec);
+
+    /* writes recompress pages which remain elias-fano when sorted */
+    size_t j = page_interval + 7;
+    zvec[j] = cvec[j] = cvec[j - 1];
+    zvec.sync();
+    assert(zvec._page_idx[1].format.codec == zvec_block_ef);
+    zvec[j] = cvec[j] = (T)(cvec[j] - 100000);
+    zvec.sync();
+    assert(zvec._page_idx[1].format.codec != zvec_block_ef);
+    for (size_t i = 0; i < cvec.size(); i += 7) {
+        assert(zvec.get(i) == cvec[i]);
+    }
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(-1000000000000ll, { 14, 3.5, 700, 50, 14 }, { 6, 4, 12, 8, 6 });
+    t1<u64>(1000000000000ull, { 14, 3.5, 700, 50, 14 }, { 6, 4, 12, 8, 6 });
+    t1<i32>(-1000000000, { 14, 3.5, 700, 50, 14 }, { 6, 4, 12, 8, 6 });
+    t1<u32>(100000000u, { 14, 3.5, 700, 50, 14 }, { 6, 4, 12, 8, 6 });
+}
@@ -0,0 +1,81 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        assert(zvec[i] == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+}
+
+template<typename T>
+void t1(T base, std::vector<u64> ranges, std::vector<int> bits)
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+
+    /* noisy metrics at a high offset where the range of each page is narrow */
+    size_t abs_size = 0;
+    for (u64 r : ranges) {
+        std::uniform_int_distribution<u64> dist(0, r);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            page[i] = (T)(base + (T)dist(engine));
+        }
+        page[1] = base, page[2] = (T)(base + (T)r);
+        zvec_stats<T> s = zvec_block_scan(page.data(), page_interval, zvec_block_abs);
+        abs_size += (zvec_size_bits(zvec_size_abs(s)) * page_interval) >> 3;
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    }
+    zvec.sync();
+
+    /* pages hold offsets from their minimum in at most half the space */
+    size_t for_size = 0;
+    for (size_t y = 0; y < ranges.size(); y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == zvec_block_for);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+        assert(idx.meta.iv == base);
+        for_size += zvec_block_size<T>(idx.format, page_interval);
+    }
+    assert(for_size * 2 <= abs_size);
+    check(zvec, cvec);
+
+    /* widening the range of a page recompresses it at the next width */
+    for (size_t i = 5; i < page_interval; i += 2) {
+        zvec[i] = cvec[i] = (T)(base + 60000 - (T)i);
+    }
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_for);
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) == 16);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(-1000000000000ll, { 200, 50000, 10000000, 200 }, { 8, 16, 24, 8 });
+    t1<u64>(1000000000000ull, { 200, 50000, 10000000, 200 }, { 8, 16, 24, 8 });
+    t1<i32>(1000000000, { 200, 50000, 10000000, 200 }, { 8, 16, 24, 8 });
+    t1<u32>(3000000000u, { 200, 50000, 10000000, 200 }, { 8, 16, 24, 8 });
+}
@@ -0,0 +1,85 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page;
+    std::vector<std::pair<zvec_codec,int>> expect;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+
+    /* flags, counters and small deltas use sub-byte and 12-bit widths */
+    auto add_page = [&](zvec_codec codec, int bits, auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+        expect.push_back({ codec, bits });
+    };
+    bool is_signed = std::is_signed<T>::value;
+    std::uniform_int_distribution<int> flag(0, 1), count(0, 5), step(-7, 7),
+        noise(0, 63), wide(0, 2000), rise(0, 3);
+    T v = 1000000;
+    add_page(is_signed ? zvec_block_for : zvec_block_abs, 1,
+        [&](size_t i) { return (T)flag(engine); });
+    add_page(is_signed ? zvec_block_for : zvec_block_abs, 3,
+        [&](size_t i) { return (T)(i < 2 ? i * 5 : count(engine)); });
+    add_page(zvec_block_rel, 4,
+        [&](size_t i) { return v = (T)(v + (i < 2 ? 7 - (T)i * 14 : step(engine))); });
+    add_page(zvec_block_for, 6,
+        [&](size_t i) { return (T)(1000000 + (i < 2 ? i * 63 : noise(engine))); });
+    add_page(zvec_block_abs, 12,
+        [&](size_t i) { return (T)(i < 2 ? i * 2000 : wide(engine)); });
+    add_page(zvec_block_mono, 2,
+        [&](size_t i) { return v = (T)(v + (i == 1 ? 3 : rise(engine))); });
+    zvec.sync();
+
+    for (size_t y = 0; y < expect.size(); y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == expect[y].first);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == expect[y].second);
+        assert(zvec_block_size<T>(idx.format, page_interval) ==
+            (size_t)expect[y].second * page_interval / 8);
+    }
+    check(zvec, cvec);
+
+    /* widening a flag page recompresses it with two bits */
+    zvec[7] = cvec[7] = 2;
+    zvec.sync();
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) == 2);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
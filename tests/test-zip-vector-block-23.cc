@@ -0,0 +1,95 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    T lo = cvec[0], hi = (T)(cvec[0] + 100);
+    assert(zvec.count_range(lo, hi) == (size_t)std::count_if(cvec.begin(),
+        cvec.end(), [&](T v) { return v >= lo && v <= hi; }));
+}
+
+template<typename T>
+void t1(T base, T spike)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<int> noise(0, 255);
+    std::uniform_int_distribution<size_t> dist(3, page_interval - 1);
+    std::uniform_int_distribution<U> wide;
+
+    auto add_page = [&](auto f, size_t outliers) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        page[1] = base;
+        for (size_t i = 0; i < outliers; i++) page[dist(engine)] = spike;
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /* 8-bit noise with a few outliers, sparse spikes and uniform values */
+    add_page([&](size_t i) { return (T)(base + (T)noise(engine)); }, 3);
+    add_page([&](size_t i) { return (T)(base + (T)(i == 2)); }, 5);
+    add_page([&](size_t i) { return (T)wide(engine); }, 0);
+    zvec.sync();
+
+    /* outliers are patched instead of widening the page */
+    auto idx = zvec._page_idx[0];
+    assert(idx.format.codec == zvec_block_pfor);
+    assert(zvec_size_bits((zvec_size)idx.format.size) == 12);
+    assert(idx.meta.iv == base);
+    assert(((U)idx.meta.dv & 0xff) == zvec_size_8);
+    idx = zvec._page_idx[1];
+    assert(idx.format.codec == zvec_block_pfor);
+    assert(zvec_size_bits((zvec_size)idx.format.size) == 1);
+    assert(((U)idx.meta.dv & 0xff) == zvec_size_0);
+    assert(((U)idx.meta.dv >> 8) == (U)std::count_if(cvec.begin() + page_interval,
+        cvec.begin() + page_interval * 2, [&](T x) { return x != base; }));
+    idx = zvec._page_idx[2];
+    assert(idx.format.codec != zvec_block_pfor);
+    check(zvec, cvec);
+
+    /* writes add and remove patches when pages are recompressed */
+    zvec[7] = cvec[7] = spike;
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_pfor);
+    check(zvec, cvec);
+    for (size_t i = 0; i < page_interval; i++) {
+        if (cvec[i] == spike) zvec[i] = cvec[i] = (T)(base + 1);
+    }
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_for);
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) == 8);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(-1000000000000ll, 1000000000000ll);
+    t1<u64>(1000000000000ull, 0xfedcba9876543210ull);
+    t1<i32>(-100000, 1000000000);
+    t1<u32>(100000u, 4000000000u);
+}
@@ -0,0 +1,84 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (T v : { (T)42, (T)-5, (T)1000000007 }) {
+        assert(zvec.count_range(v, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    const T codes[] = { (T)1000000007, (T)-5, (T)42, (T)1999999999 };
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /* status columns with long runs, short runs and a constant page */
+    add_page([&](size_t i) { return codes[(i * 12 / page_interval) & 3]; });
+    add_page([&](size_t i) { return codes[i & 3]; });
+    add_page([&](size_t i) { return codes[2]; });
+    zvec.sync();
+
+    /* runs are held in 64 or 128 bytes instead of full width values */
+    auto idx = zvec._page_idx[0];
+    assert(idx.format.codec == zvec_block_rle);
+    assert(idx.meta.dv == 12);
+    assert(zvec_block_size<T>(idx.format, page_interval) == 128);
+    assert(zvec._page_idx[1].format.codec != zvec_block_rle);
+    assert(zvec._page_idx[2].format.codec == zvec_const_abs);
+    check(zvec, cvec);
+
+    /* a write inside a run splits it and a write of a page of runs */
+    zvec[100] = cvec[100] = codes[3];
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_rle);
+    assert(zvec._page_idx[0].meta.dv == 14);
+    check(zvec, cvec);
+    for (size_t i = 0; i < page_interval; i++) {
+        zvec[page_interval + i] = cvec[page_interval + i] = codes[(i >> 6) & 3];
+    }
+    zvec.sync();
+    assert(zvec._page_idx[1].format.codec == zvec_block_rle);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
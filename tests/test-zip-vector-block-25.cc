@@ -0,0 +1,97 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, std::vector<T> &keys)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (T v : keys) {
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_lt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x < v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page, keys;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<U> wide;
+
+    /* pages of hashed keys with 5, 200, 300 and 3 distinct values */
+    auto add_page = [&](size_t distinct) {
+        std::vector<T> dict(distinct);
+        for (size_t k = 0; k < distinct; k++) dict[k] = (T)wide(engine);
+        std::uniform_int_distribution<size_t> pick(0, distinct - 1);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            page[i] = dict[i < distinct ? i : pick(engine)];
+        }
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+        keys.push_back(dict[0]);
+        keys.push_back((T)(dict[0] + 1));
+    };
+    add_page(5);
+    add_page(200);
+    add_page(300);
+    add_page(3);
+    zvec.sync();
+
+    /* indices and table fit the smallest size holding both */
+    int bits[] = { 4, sizeof(T) == 8 ? 48 : 16, 0, 3 };
+    size_t count[] = { 5, 200, 0, 3 };
+    for (size_t y = 0; y < 4; y++) {
+        auto idx = zvec._page_idx[y];
+        if (count[y] == 0) {
+            assert(idx.format.codec != zvec_block_dict);
+            continue;
+        }
+        assert(idx.format.codec == zvec_block_dict);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+        assert((size_t)(U)idx.meta.dv == count[y]);
+    }
+    check(zvec, cvec, keys);
+
+    /* a new value is added to the table when the page is recompressed */
+    zvec[9] = cvec[9] = (T)12345;
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_dict);
+    assert(zvec._page_idx[0].meta.dv == 6);
+    keys.push_back((T)12345);
+    check(zvec, cvec, keys);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
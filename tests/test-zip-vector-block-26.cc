@@ -0,0 +1,84 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_ge, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x >= v; }));
+    }
+}
+
+template<typename T>
+void t1(T base, T slope)
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+    std::uniform_int_distribution<int> jitter(-3, 3);
+
+    /* timestamps with jitter, a descending series and an exact series */
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+    add_page([&](size_t i) { return (T)(base + (T)i * slope + (T)jitter(engine)); });
+    add_page([&](size_t i) { return (T)(base - (T)i * slope + (T)(i % 3)); });
+    add_page([&](size_t i) { return (T)(base + (T)i * slope); });
+    zvec.sync();
+
+    /* residuals from the line are packed at the narrowest width */
+    int bits[] = { 3, 2 };
+    for (size_t y = 0; y < 2; y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == zvec_block_lin);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+        assert(idx.meta.dv == (T)(y == 0 ? slope : -slope));
+    }
+    assert(zvec._page_idx[2].format.codec == zvec_const_rel);
+    check(zvec, cvec);
+
+    /* an outlier widens the residuals when the page is recompressed */
+    zvec[5] = cvec[5] = (T)(cvec[5] + 100);
+    zvec.sync();
+    auto idx = zvec._page_idx[0];
+    assert(idx.format.codec == zvec_block_lin);
+    assert(zvec_size_bits((zvec_size)idx.format.size) == 8);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(1600000000000ll, 1000);
+    t1<u64>(1600000000000ull, 1000);
+    t1<i32>(100000000, 1000);
+    t1<u32>(100000000u, 1000);
+}
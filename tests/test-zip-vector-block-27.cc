@@ -0,0 +1,88 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == cvec.front());
+    assert(zvec.max() == cvec.back());
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert((size_t)zvec.lower_bound(v) == i);
+        assert(zvec.count_if(zvec_cmp_lt, v) == i);
+    }
+}
+
+template<typename T>
+void t1(T base, T interval)
+{
+    using TS = typename std::make_signed<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937 engine;
+
+    /* timestamps whose interval drifts by a bounded step per element */
+    T v = base;
+    TS d = (TS)interval;
+    auto add_page = [&](int step) {
+        std::uniform_int_distribution<int> drift(-step, step);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            d += drift(engine);
+            page[i] = v = (T)(v + (T)d);
+        }
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+    add_page(2);
+    add_page(100);
+    add_page(1);
+    zvec.sync();
+
+    /* second-order deltas are packed at the narrowest signed width */
+    int bits[] = { 3, 8, 2 };
+    for (size_t y = 0; y < 3; y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == zvec_block_dod);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+    }
+    check(zvec, cvec);
+
+    /* a late element widens the second-order deltas of its page */
+    zvec[5] = cvec[5] = (T)(cvec[5] + 50);
+    zvec.sync();
+    auto idx = zvec._page_idx[0];
+    assert(idx.format.codec == zvec_block_dod);
+    assert(zvec_size_bits((zvec_size)idx.format.size) == 8);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>(1700000000000000000ll, 1000000);
+    t1<u64>(1700000000000000000ull, 1000000);
+    t1<i32>(100000000, 100000);
+    t1<u32>(100000000u, 100000);
+}
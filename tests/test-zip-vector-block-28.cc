@@ -0,0 +1,96 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_gt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x > v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+
+    /* aligned pointers, prices in cents and timestamps in milliseconds */
+    auto add_page = [&](T base, U stride, U count) {
+        std::uniform_int_distribution<U> dist(0, count - 1);
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) {
+            page[i] = (T)((U)base + dist(engine) * stride);
+        }
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+    T money = std::is_signed<T>::value ? (T)-500000 : (T)0;
+    if constexpr (sizeof(T) == 8) {
+        add_page((T)0x7f0000000000ull, 16, 1ull << 32);
+        add_page(money, 100, 10001);
+        add_page((T)1700000000000ull, 1000, 1000000);
+    } else {
+        add_page((T)0x10000000u, 8, 1u << 24);
+        add_page(money, 100, 10001);
+        add_page((T)0, 1000, 100000);
+    }
+    zvec.sync();
+
+    /* quotients are packed at the width of the range over the divisor */
+    int bits[] = { sizeof(T) == 8 ? 32 : 24, 16, 24 };
+    U div[] = { sizeof(T) == 8 ? 16u : 8u, 100, 1000 };
+    for (size_t y = 0; y < 3; y++) {
+        auto idx = zvec._page_idx[y];
+        assert(idx.format.codec == zvec_block_gcd);
+        assert(zvec_size_bits((zvec_size)idx.format.size) == bits[y]);
+        assert((U)idx.meta.dv == div[y]);
+    }
+    check(zvec, cvec);
+
+    /* a value off the stride leaves the divisor when recompressed */
+    zvec[7] = cvec[7] = (T)(cvec[7] + 1);
+    zvec[page_interval + 7] = cvec[page_interval + 7] = (T)(cvec[page_interval + 7] + 50);
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec != zvec_block_gcd);
+    assert(zvec._page_idx[1].format.codec == zvec_block_gcd);
+    assert(zvec._page_idx[1].meta.dv == 50);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
@@ -0,0 +1,143 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+#include <cmath>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec, std::vector<T> probes)
+{
+    T min = zvec_highest<T>(), max = zvec_lowest<T>();
+    long double sum = 0, mag = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec_float_bits((T)zvec.get(i)) == zvec_float_bits(cvec[i]));
+        assert(zvec_float_bits((T)zvec[i]) == zvec_float_bits(cvec[i]));
+        if (std::isnan(cvec[i])) continue;
+        min = std::min(min, cvec[i]), max = std::max(max, cvec[i]);
+        sum += cvec[i], mag += std::fabs(cvec[i]);
+    }
+    zvec_aggr<T> a = zvec.aggregate();
+    assert(a.min == min && a.max == max);
+    if (std::isfinite(sum)) {
+        assert(std::fabs(a.sum - sum) <= mag * (sizeof(T) == 8 ? 1e-12 : 1e-5));
+    }
+
+    probes.push_back(zvec_lowest<T>());
+    probes.push_back(zvec_highest<T>());
+    probes.push_back(std::numeric_limits<T>::quiet_NaN());
+    probes.push_back(0);
+    for (T v : probes) {
+        size_t c[6] = { 0 };
+        for (T x : cvec) {
+            c[zvec_cmp_eq] += x == v;
+            c[zvec_cmp_ne] += x != v;
+            c[zvec_cmp_lt] += x < v;
+            c[zvec_cmp_le] += x <= v;
+            c[zvec_cmp_gt] += x > v;
+            c[zvec_cmp_ge] += x >= v;
+        }
+        for (int cmp = zvec_cmp_eq; cmp <= zvec_cmp_ge; cmp++) {
+            assert(zvec.count_if((zvec_cmp)cmp, v) == c[cmp]);
+        }
+    }
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page, probes;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<int> cents(10000, 20000);
+    std::uniform_int_distribution<int> steps(0, 1023);
+    std::uniform_real_distribution<T> noise(-1e6, 1e6);
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /* prices, binary fractions near 1024, a constant and random values */
+    add_page([&](size_t i) { return (T)cents(engine) / (T)100; });
+    add_page([&](size_t i) { return (T)1024 + (T)steps(engine) / (T)256; });
+    add_page([&](size_t i) { return (T)3.14159; });
+    add_page([&](size_t i) { return noise(engine); });
+    zvec.sync();
+
+    /* prices scale by 10^2 to offsets below 2^16, the fractions share
+     * their sign, exponent and high mantissa bits so xor to 10 bits */
+    auto idx = zvec._page_idx;
+    assert(idx[0].format.codec == zvec_block_decimal);
+    assert(zvec_size_bits((zvec_size)idx[0].format.size) == 16);
+    assert(idx[0].meta.dv == 2);
+    assert(idx[1].format.codec == zvec_block_xor);
+    assert(zvec_size_bits((zvec_size)idx[1].format.size) == 12);
+    assert(idx[1].meta.dv == (sizeof(T) == 8 ? 34 : 5));
+    assert(idx[2].format.codec == zvec_const_abs);
+    assert(zvec_size_bits((zvec_size)idx[3].format.size) == (int)sizeof(T) * 8);
+    for (size_t i = 0; i < cvec.size(); i += 37) probes.push_back(cvec[i]);
+    check(zvec, cvec, probes);
+
+    /* a value without a short decimal leaves the price page as xor or raw */
+    zvec[5] = cvec[5] = (T)1 / (T)3;
+    zvec[page_interval * 2 + 9] = cvec[page_interval * 2 + 9] = (T)2.5;
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec != zvec_block_decimal);
+    assert(zvec._page_idx[2].format.codec == zvec_block_decimal);
+    check(zvec, cvec, probes);
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec, probes);
+
+    dump_index(zvec);
+}
+
+template<typename T>
+void t2()
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /* signed zeros differ in one bit, special values are kept exactly */
+    add_page([&](size_t i) { return i % 3 == 0 ? (T)-0.0 : (T)0.0; });
+    add_page([&](size_t i) { return i % 5 == 0 ? nan : i % 7 == 0 ? -inf : (T)(i % 9); });
+    add_page([&](size_t i) { return i % 2 ? inf : (T)-1.25; });
+    zvec.sync();
+
+    assert(zvec._page_idx[0].format.codec == zvec_block_xor);
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) == 1);
+    check(zvec, cvec, { (T)-0.0, (T)1, (T)8, (T)-1.25, inf, -inf });
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec, { (T)-0.0, (T)1, (T)8, (T)-1.25, inf, -inf });
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<double>();
+    t1<float>();
+    t2<double>();
+    t2<float>();
+}
@@ -0,0 +1,110 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_gt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x > v; }));
+        assert(zvec.count_if(zvec_cmp_le, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x <= v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<int> step(-3, 3);
+    std::uniform_int_distribution<int> small(0, sizeof(T) == 2 ? 1023 : 31);
+    std::uniform_int_distribution<int> byte(std::is_signed<T>::value ? -100 : 0,
+                                            std::is_signed<T>::value ? 100 : 200);
+    std::uniform_int_distribution<int> full(std::numeric_limits<T>::min(),
+                                            std::numeric_limits<T>::max());
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = (T)f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /* constant, ramp, small values, random walk, random and byte pages */
+    T walk = 0;
+    add_page([&](size_t i) { return 42; });
+    add_page([&](size_t i) { return (U)(i * 3); });
+    add_page([&](size_t i) { return small(engine); });
+    add_page([&](size_t i) { return walk = (T)((U)walk + (U)step(engine)); });
+    add_page([&](size_t i) { return full(engine); });
+    if constexpr (sizeof(T) == 2) {
+        add_page([&](size_t i) { return byte(engine); });
+    }
+    zvec.sync();
+
+    /* small values pack to 12 or 6 bits and walks to 3 bit deltas */
+    auto idx = zvec._page_idx;
+    assert(idx[0].format.codec == zvec_const_abs);
+    assert(idx[0].meta.iv == 42);
+    assert(idx[1].format.codec == zvec_const_rel);
+    assert(idx[1].meta.dv == 3);
+    assert(idx[2].format.codec == zvec_block_abs);
+    assert(zvec_size_bits((zvec_size)idx[2].format.size) == (sizeof(T) == 2 ? 12 : 6));
+    assert(idx[3].format.codec == zvec_block_rel);
+    assert(zvec_size_bits((zvec_size)idx[3].format.size) == 3);
+    assert(zvec_size_bits((zvec_size)idx[4].format.size) == (int)sizeof(T) * 8);
+    if constexpr (sizeof(T) == 2) {
+        assert(idx[5].format.codec == zvec_block_abs);
+        assert(zvec_size_bits((zvec_size)idx[5].format.size) == 8);
+    }
+    check(zvec, cvec);
+
+    /* writes recompress the constant page and widen the small values */
+    zvec[3] = cvec[3] = 7;
+    zvec[page_interval * 2 + 5] = cvec[page_interval * 2 + 5] = (T)(std::numeric_limits<T>::max() / 2 + 1);
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec == zvec_block_abs);
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) == (std::is_signed<T>::value ? 8 : 6));
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[2].format.size) == (int)sizeof(T) * 8);
+    check(zvec, cvec);
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i16>();
+    t1<u16>();
+    t1<i8>();
+    t1<u8>();
+}
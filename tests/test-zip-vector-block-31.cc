@@ -0,0 +1,109 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_gt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x > v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    const T level = sizeof(T) == 8 ? (T)5000000000ll : (T)900000000;
+    const T noise = sizeof(T) == 8 ? (T)(1ll << 40) : (T)(1 << 20);
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<int> small(0, 200);
+    std::uniform_int_distribution<int> jitter(0, 40);
+    std::uniform_int_distribution<i64> burst(0, (i64)noise - 1);
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    /*
+     * small values with one noisy run and one run of steps, small values
+     * around two levels, a constant run among noise and plain noise.
+     */
+    T step = 1000;
+    add_page([&](size_t i) {
+        size_t j = i / zvec_mini_lanes;
+        if (j == 3) return (T)burst(engine);
+        if (j == 5) return step += (T)(60 + jitter(engine));
+        return (T)(1000 + small(engine));
+    });
+    add_page([&](size_t i) {
+        return (T)((i < page_interval / 2 ? 1000 : level) + small(engine));
+    });
+    add_page([&](size_t i) {
+        return i / zvec_mini_lanes == 2 ? (T)77 : (T)burst(engine);
+    });
+    add_page([&](size_t i) { return (T)burst(engine); });
+    zvec.sync();
+
+    /* one page width would be the noise or level width for every run */
+    auto idx = zvec._page_idx;
+    assert(idx[0].format.codec == zvec_block_mini);
+    assert(zvec_size_bits((zvec_size)idx[0].format.size) <= 16);
+    assert(idx[1].format.codec == zvec_block_mini);
+    assert(zvec_size_bits((zvec_size)idx[1].format.size) <= 12);
+    assert(idx[2].format.codec != zvec_block_mini);
+    assert(idx[3].format.codec != zvec_block_mini);
+    check(zvec, cvec);
+
+    /* a write into the level run widens it, quieting the noisy run narrows it */
+    zvec[page_interval + 3] = cvec[page_interval + 3] = (T)(level + 7);
+    for (size_t i = 0; i < zvec_mini_lanes; i++) {
+        size_t k = 3 * zvec_mini_lanes + i;
+        zvec[k] = cvec[k] = (T)(1000 + i);
+    }
+    zvec.sync();
+    assert(zvec_size_bits((zvec_size)zvec._page_idx[0].format.size) <= 12);
+    assert(zvec._page_idx[1].format.codec == zvec_block_mini);
+    check(zvec, cvec);
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
@@ -0,0 +1,92 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_lt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x < v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<int> pick(0, 99);
+
+    /* mostly one byte values with a tail of two, three and full width values */
+    auto tail = [&](T base, int wide) {
+        int p = pick(engine), b = p < 70 ? 8 : p < 90 ? 16 : p < 100 - wide ? 24 : sizeof(T) * 8 - 4;
+        return (T)(base + (T)(engine() & (((u64)1 << b) - 1)));
+    };
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+
+    const T base = std::is_signed<T>::value ? (T)-1000 : (T)1000;
+    add_page([&](size_t i) { return tail(0, 3); });
+    add_page([&](size_t i) { return tail(base, 3); });
+    add_page([&](size_t i) { return tail(0, 0); });
+    zvec.sync();
+
+    /* one width or a patch list would be the width of the tail */
+    auto idx = zvec._page_idx;
+    assert(idx[0].format.codec == zvec_block_svb);
+    assert(idx[1].format.codec == zvec_block_svb);
+    assert(idx[1].meta.iv >= base && idx[1].meta.iv < base + 256);
+    assert(idx[2].format.codec == zvec_block_svb);
+    assert(zvec_size_bits((zvec_size)idx[0].format.size) <= 16);
+    check(zvec, cvec);
+
+    /* full width values in every element leave nothing to save */
+    for (size_t i = 0; i < page_interval; i++) {
+        zvec[i] = cvec[i] = (T)(engine() | ((u64)1 << (sizeof(T) * 8 - 2)));
+    }
+    zvec.sync();
+    assert(zvec._page_idx[0].format.codec != zvec_block_svb);
+    check(zvec, cvec);
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
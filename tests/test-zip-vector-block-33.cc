@@ -0,0 +1,123 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+
+template<typename T>
+void check(zip_vector<T> &zvec, std::vector<T> &cvec)
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U sum = 0;
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec.get(i) == cvec[i]);
+        sum += (U)cvec[i];
+    }
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+    assert(zvec.sum() == (T)sum);
+    assert(zvec.min() == *std::min_element(cvec.begin(), cvec.end()));
+    assert(zvec.max() == *std::max_element(cvec.begin(), cvec.end()));
+    for (size_t i = 0; i < cvec.size(); i += 97) {
+        T v = cvec[i];
+        assert(zvec.count_if(zvec_cmp_eq, v) == (size_t)std::count(cvec.begin(), cvec.end(), v));
+        assert(zvec.count_if(zvec_cmp_lt, v) == (size_t)std::count_if(cvec.begin(),
+            cvec.end(), [&](T x) { return x < v; }));
+    }
+}
+
+template<typename T>
+void t1()
+{
+    std::vector<T> cvec, page;
+    zip_vector<T> zvec;
+
+    enum test : size_t { page_interval = zip_vector<T>::page_interval };
+
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<int> small(0, 100);
+
+    zvec.set_ref_pages(true);
+
+    auto add_page = [&](auto f) {
+        page.resize(page_interval);
+        for (size_t i = 0; i < page_interval; i++) page[i] = f(i);
+        cvec.insert(cvec.end(), page.begin(), page.end());
+        zvec.append(page.data(), page_interval);
+    };
+    auto prev = [&](size_t k, size_t i) { return cvec[cvec.size() - k * page_interval + i]; };
+
+    /*
+     * a noisy page, the same page with a few small changes, the same page
+     * shifted, more noise, an exact repeat and a repeat of the first page
+     * outside of the reference window.
+     */
+    add_page([&](size_t i) { return (T)engine(); });
+    add_page([&](size_t i) { return (T)(prev(1, i) + (i % 16 == 0 ? small(engine) : 0)); });
+    add_page([&](size_t i) { return (T)(prev(2, i) + 5); });
+    add_page([&](size_t i) { return (T)engine(); });
+    add_page([&](size_t i) { return prev(1, i); });
+    add_page([&](size_t i) { return prev(5, i); });
+    zvec.sync();
+
+    /* repeats drop to narrow differences or no block at all */
+    auto idx = zvec._page_idx;
+    assert(idx[0].format.codec != zvec_block_ref);
+    assert(idx[1].format.codec == zvec_block_ref);
+    assert(idx[1].meta.iv == 1);
+    assert(zvec_size_bits((zvec_size)idx[1].format.size) <= 8);
+    assert(idx[2].format.codec == zvec_block_ref);
+    assert(idx[2].format.size == zvec_size_0);
+    assert(idx[2].meta.iv == 2 && idx[2].meta.dv == 5);
+    assert(idx[3].format.codec != zvec_block_ref);
+    assert(idx[4].format.codec == zvec_block_ref);
+    assert(idx[4].format.size == zvec_size_0);
+    assert(idx[4].meta.iv == 1);
+    assert(idx[5].format.codec != zvec_block_ref);
+    check(zvec, cvec);
+
+    /* writes to a referenced page store the pages referring to it again */
+    zvec[7] = cvec[7] = (T)42;
+    zvec[page_interval * 3 + 9] = cvec[page_interval * 3 + 9] = (T)43;
+    zvec.sync();
+    check(zvec, cvec);
+
+    std::uniform_int_distribution<size_t> where(0, cvec.size() - 1);
+    for (size_t i = 0; i < 1000; i++) {
+        size_t k = where(engine);
+        zvec[k] = cvec[k] = (T)(cvec[k] + small(engine));
+        if (i % 100 == 0) check(zvec, cvec);
+    }
+    zvec.sync();
+    check(zvec, cvec);
+
+    zvec.set_zone_maps(true);
+    check(zvec, cvec);
+
+    /* with the search off references stay readable until pages are rewritten */
+    zvec.set_ref_pages(false);
+    check(zvec, cvec);
+    for (size_t y = 0; y < zvec.page_count(); y++) {
+        size_t k = y * page_interval + 11;
+        zvec[k] = cvec[k] = (T)(cvec[k] + 1);
+    }
+    zvec.sync();
+    for (size_t y = 0; y < zvec.page_count(); y++) {
+        assert(zvec._page_idx[y].format.codec != zvec_block_ref);
+    }
+    check(zvec, cvec);
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<u64>();
+    t1<i32>();
+    t1<u32>();
+}
@@ -0,0 +1,91 @@
+#undef NDEBUG
+#define ZIP_VECTOR_TRACE 1
+#include <zip_vector.h>
+#include "test-zip-vector-common.h"
+
+#include <vector>
+#include <thread>
+
+template<typename T>
+void t1()
+{
+    block_random<T> rng;
+    std::vector<T> cvec;
+    zip_vector<T> zvec;
+
+    enum test : size_t { test_size = 65536, num_threads = 8 };
+
+    /* write random values to array and check array */
+    cvec.resize(test_size);
+    zvec.resize(test_size);
+    for (size_t i = 0; i < cvec.size(); i++) {
+        cvec[i] = zvec[i] = rng.val();
+    }
+    zvec.sync();
+
+    /* concurrent readers sharing pages */
+    T s1 = 0;
+    for (auto v : cvec) {
+        s1 += (T)v;
+    }
+    std::vector<T> sums(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            typename zip_vector<T>::accessor a(zvec);
+            T s = 0;
+            for (size_t i = 0; i < test_size; i++) {
+                s += a.get(i);
+            }
+            sums[t] = s;
+        });
+    }
+    for (auto &th : threads) th.join();
+    threads.clear();
+    for (auto s : sums) {
+        assert(s == s1);
+    }
+
+    /* concurrent readers jumping between pages so pins are reused */
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            typename zip_vector<T>::accessor a(zvec);
+            std::mt19937 engine((unsigned)t);
+            std::uniform_int_distribution<size_t> dist(0, test_size - 1);
+            for (size_t j = 0; j < test_size; j++) {
+                size_t i = dist(engine);
+                assert(a.get(i) == cvec[i]);
+            }
+        });
+    }
+    for (auto &th : threads) th.join();
+    threads.clear();
+
+    /* concurrent writers interleaved within pages */
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            typename zip_vector<T>::accessor a(zvec);
+            for (size_t i = t; i < test_size; i += num_threads) {
+                a.set(i, a.get(i) + (T)i);
+                cvec[i] += (T)i;
+            }
+        });
+    }
+    for (auto &th : threads) th.join();
+
+    /* check single-threaded access against control vector */
+    for (size_t i = 0; i < cvec.size(); i++) {
+        assert(zvec[i] == cvec[i]);
+    }
+
+    zvec.sync();
+
+    dump_index(zvec);
+}
+
+int main(int argc, const char **argv)
+{
+    parse_options(argc, argv);
+    t1<i64>();
+    t1<i32>();
+}
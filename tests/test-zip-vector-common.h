@@ -154,14 +154,22 @@ void dump_index(ZV& vec)
         const char *codec = zvec_codec_name((zvec_codec)p.format.codec);
         size_t block_size = ((size_t)size * ZV::page_interval) >> 3;
         float ratio = ((float)block_size / (float)page_size) * 100.0f;
-        if constexpr (sizeof(typename ZV::value_type) == 8) {
+        if constexpr (std::is_floating_point<typename ZV::value_type>::value) {
+            printf("block[%-5zd] fmt=%-10s:%-3zd size=[%5zu/%-5zu] (%5.1f%%) offset=%-9zd iv=%g dv=%g\n",
+                i, codec, size, block_size, page_size, ratio, p.offset, (double)p.meta.iv, (double)p.meta.dv);
+        }
+        else if constexpr (sizeof(typename ZV::value_type) == 8) {
             printf("block[%-5zd] fmt=%-10s:%-3zd size=[%5zu/%-5zu] (%5.1f%%) offset=%-9zd iv=%" PRId64 " dv=%" PRId64 "\n",
                 i, codec, size, block_size, page_size, ratio, p.offset, p.meta.iv, p.meta.dv);
         }
-        if constexpr (sizeof(typename ZV::value_type) == 4) {
+        else if constexpr (sizeof(typename ZV::value_type) == 4) {
             printf("block[%-5zd] fmt=%-10s:%-3zd size=[%5zu/%-5zu] (%5.1f%%) offset=%-9zd iv=%" PRId32 " dv=%" PRId32 "\n",
                 i, codec, size, block_size, page_size, ratio, p.offset, p.meta.iv, p.meta.dv);
         }
+        else {
+            printf("block[%-5zd] fmt=%-10s:%-3zd size=[%5zu/%-5zu] (%5.1f%%) offset=%-9zd iv=%d dv=%d\n",
+                i, codec, size, block_size, page_size, ratio, p.offset, (int)p.meta.iv, (int)p.meta.dv);
+        }
         vec_used += block_size;
     }
 